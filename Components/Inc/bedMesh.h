@@ -0,0 +1,72 @@
+/**
+  ******************************************************************************
+  * @file    bedMesh.h
+  * @author  Nikita lazarev <nikitaterm@gmail.com>
+  * @version V1.01
+  * @date    29-May-2016
+  * @brief   Header file of the bed mesh module.
+  ******************************************************************************
+  * Project: P3D_firmware
+  * Description:
+  * The bed mesh is the grid of the bed heights measured by the Z-probe,
+  * see ProbeGrid(). The motion controller adds the height interpolated
+  * bilinearly over the mesh to Z of every segment, so the tool follows
+  * the uneven bed. The mesh is kept in a flash sector, so it survives
+  * the reset.
+  ****Resources being consumed****
+  * Flash sector 11 (0x080E0000 - 0x080FFFFF), mustn't be used by the program
+  */
+
+#ifndef _BED_MESH_H_
+#define _BED_MESH_H_
+
+#include "stdint.h"
+
+#include "error.h"
+
+#define BED_MESH_MAX_X 16   // Specifies the max number of the mesh points along X
+#define BED_MESH_MAX_Y 16   // Specifies the max number of the mesh points along Y
+
+/**
+  * @brief Load the mesh from the flash.
+  * Returns _OutOfRange if there is no valid mesh in the flash, the mesh
+  * is cleared then.
+  */
+Error BedMeshLoad(void);
+
+/**
+  * @brief Save the mesh to the flash.
+  * The flash sector erase stalls the CPU for up to a few seconds, so this
+  * mustn't be called while the motors are moving.
+  */
+Error BedMeshSave(void);
+
+/**
+  * @brief Set the mesh of nX*nY heights (mm), Z[j*nX + i] is the height at
+  * (X0 + i*dX, Y0 + j*dY), nX and nY are 2 at least. The heights are
+  * stored with 1 um resolution, so they mustn't exceed 32 mm.
+  * Mustn't be called while the moves are being planned.
+  */
+Error BedMeshSet(float X0, float Y0, float dX, float dY, uint32_t nX, uint32_t nY, const float* Z);
+
+/**
+  * @brief Clear the mesh, the height is zero everywhere then
+  */
+void BedMeshClear(void);
+
+/**
+  * @brief Get the bed height at the point, mm.
+  * The height is interpolated bilinearly, the points out of the mesh get
+  * the height of its nearest edge.
+  */
+float BedMeshGetZ(float X, float Y);
+
+/**
+  * @brief Get where the line (X + dx*t, Y + dy*t) crosses the next cell
+  * boundary of the mesh after t, 0 <= t < 1. The height is bilinear within
+  * a cell only, so the segments are split there.
+  * Returns 1 if the line doesn't cross a boundary before its end.
+  */
+float BedMeshNextBoundary(float X, float Y, float dx, float dy, float t);
+
+#endif
@@ -21,7 +21,10 @@ typedef enum
   _HALError,
   _OutOfRange,
   _UnitTestError,
-  _IncompatibleArgs
+  _IncompatibleArgs,
+  _QueueFull,
+  _Timeout,
+  _Aborted
 
 } Error;
 
@@ -0,0 +1,84 @@
+/**
+  ******************************************************************************
+  * @file    kinematics.h
+  * @author  Nikita lazarev <nikitaterm@gmail.com>
+  * @version V1.01
+  * @date    29-May-2016
+  * @brief   Header file of the inverse kinematics module.
+  ******************************************************************************
+  * Project: P3D_firmware
+  * Description:
+  * This module converts the cartesian coordinates of the tool to the
+  * angles of the step motors. Please, refer to the Kinematic.png file
+  * for the graphic representation of the mechanism.
+  * KinGetAngles() is the single precision implementation used for the
+  * track planning, it runs on the FPU and doesn't call libm except sqrtf.
+  * KinLookUpAngles() interpolates the look-up tables generated by
+  * Components/tools/kinematicsLookUpGen.c and is the fastest one.
+  * KinGetAnglesRef() is the double precision reference.
+  * KinGetPoint() solves the kinematics the other way round, it's used to
+  * find the tool after the motors are stopped off the planned path.
+  */
+
+#ifndef _KINEMATICS_H_
+#define _KINEMATICS_H_
+
+#include "error.h"
+#include "stepMotor.h"
+
+/** Specifies the transformation values of all axises.
+  */
+#define Kx 72  // =360/screw_step (in mm)
+#define Ky 72  // =360/screw_step (in mm)
+#define Kz 120  // =360/screw_step (in mm)
+
+/** Specifies the max error (in grads) of KinGetAngles() and KinLookUpAngles() against
+  * KinGetAnglesRef() over the workspace, it's checked by kinematics_test.c.
+  */
+#define KIN_MAX_ERROR 0.01
+
+/** Specifies the max error (in mm) of KinGetPoint() and the max number of
+  * the corrections it makes.
+  */
+#define KIN_POINT_TOLERANCE   1e-6
+#define KIN_POINT_ITERATIONS  16
+
+/**
+  * @brief Get the angles of all motors for the specified point.
+  * angle is indexed by Axis.
+  * Returns _OutOfRange if the point can't be reached or the angles aren't
+  * defined there (X = Z = 0 or Y = Z = 0).
+  */
+Error KinGetAngles(float X, float Y, float Z, float angle[AXIS_AMOUNT]);
+
+/**
+  * @brief Get the angles of all motors for the specified point using the
+  * look-up tables. The points out of the tables are passed to KinGetAngles().
+  * Returns _OutOfRange if the point can't be reached.
+  */
+Error KinLookUpAngles(float X, float Y, float Z, float angle[AXIS_AMOUNT]);
+
+/**
+  * @brief Get the Jacobian of KinGetAngles() at the specified point:
+  * J[axis][i] is the derivative of the axis angle by the i-th coordinate
+  * (X, Y, Z), grads/mm. The motor speeds for the tool velocity V are J*V.
+  * Returns _OutOfRange if the point can't be reached or is singular.
+  */
+Error KinGetJacobian(float X, float Y, float Z, float J[AXIS_AMOUNT][AXIS_AMOUNT]);
+
+/**
+  * @brief Double precision reference of KinGetAngles()
+  */
+Error KinGetAnglesRef(double X, double Y, double Z, double angle[AXIS_AMOUNT]);
+
+/**
+  * @brief Get the point of the tool for the angles of all motors.
+  * point is the point (X, Y, Z) close to the one being searched for, it's
+  * set to the point found. The angle of a motor is the coordinate of its
+  * axis times its K plus the lever part changing slowly, so the coordinates
+  * are corrected by the angle errors of KinGetAnglesRef() until they converge.
+  * Returns _OutOfRange if the angles can't be reached.
+  */
+Error KinGetPoint(const double angle[AXIS_AMOUNT], double point[3]);
+
+#endif
@@ -0,0 +1,1249 @@
+/**
+  ******************************************************************************
+  * @file    kinematicsLookUp.h
+  * @author  Nikita lazarev <nikitaterm@gmail.com>
+  * @version V1.01
+  * @date    29-May-2016
+  * @brief   Header file with look-up tables for the inverse kinematics.
+  ******************************************************************************
+  * This file is generated by Components/tools/kinematicsLookUpGen.c,
+  * don't edit it manually.
+  */
+
+/**
+  * @brief Look-up tables of the lever angles, indexed by [Z][A].
+  * The max error of the bilinear interpolation is 0.0051 grads.
+  */
+#define KIN_LU_A_MIN 20
+#define KIN_LU_Z_MIN -300
+#define KIN_LU_STEP 5
+#define KIN_LU_A_SIZE 57
+#define KIN_LU_Z_SIZE 61
+#define KIN_LU_MAX_ERROR 0.0051
+
+static const float kin_x_lu[KIN_LU_Z_SIZE][KIN_LU_A_SIZE] = {
+  {-88.36677f, -88.35327f, -88.33997f, -88.32688f, -88.31399f, -88.30133f,
+   -88.2889f, -88.27671f, -88.26477f, -88.25308f, -88.24165f, -88.2305f,
+   -88.21962f, -88.20903f, -88.19873f, -88.18873f, -88.17903f, -88.16964f,
+   -88.16056f, -88.15181f, -88.14338f, -88.13528f, -88.12752f, -88.12009f,
+   -88.11301f, -88.10628f, -88.09991f, -88.09389f, -88.08823f, -88.08294f,
+   -88.07802f, -88.07347f, -88.0693f, -88.06552f, -88.06213f, -88.05913f,
+   -88.05653f, -88.05434f, -88.05257f, -88.05121f, -88.05029f, -88.04981f,
+   -88.04978f, -88.05021f, -88.05112f, -88.05252f, -88.05443f, -88.05687f,
+   -88.05987f, -88.06345f, -88.06764f, -88.07248f, -88.07801f, -88.08429f,
+   -88.09138f, -88.09936f, -88.10833f},
+  {-88.3569f, -88.34312f, -88.32953f, -88.31616f, -88.303f, -88.29006f,
+   -88.27736f, -88.26491f, -88.2527f, -88.24076f, -88.22908f, -88.21768f,
+   -88.20656f, -88.19573f, -88.1852f, -88.17497f, -88.16505f, -88.15544f,
+   -88.14616f, -88.1372f, -88.12857f, -88.12028f, -88.11233f, -88.10473f,
+   -88.09747f, -88.09057f, -88.08402f, -88.07784f, -88.07202f, -88.06657f,
+   -88.0615f, -88.0568f, -88.05249f, -88.04856f, -88.04502f, -88.04188f,
+   -88.03914f, -88.03681f, -88.03489f, -88.03339f, -88.03232f, -88.03169f,
+   -88.0315f, -88.03177f, -88.03251f, -88.03374f, -88.03547f, -88.03771f,
+   -88.0405f, -88.04384f, -88.04779f, -88.05235f, -88.05758f, -88.06353f,
+   -88.07024f, -88.07779f, -88.08625f},
+  {-88.34715f, -88.33308f, -88.3192f, -88.30554f, -88.29209f, -88.27888f,
+   -88.2659f, -88.25317f, -88.2407f, -88.22849f, -88.21655f, -88.2049f,
+   -88.19353f, -88.18246f, -88.17169f, -88.16123f, -88.15108f, -88.14126f,
+   -88.13177f, -88.1226f, -88.11377f, -88.10529f, -88.09715f, -88.08936f,
+   -88.08193f, -88.07486f, -88.06814f, -88.0618f, -88.05582f, -88.05022f,
+   -88.045f, -88.04016f, -88.0357f, -88.03163f, -88.02795f, -88.02467f,
+   -88.0218f, -88.01933f, -88.01727f, -88.01564f, -88.01443f, -88.01365f,
+   -88.01332f, -88.01345f, -88.01403f, -88.0151f, -88.01665f, -88.01872f,
+   -88.02131f, -88.02445f, -88.02817f, -88.03249f, -88.03745f, -88.04309f,
+   -88.04946f, -88.05663f, -88.06465f},
+  {-88.33753f, -88.32315f, -88.30898f, -88.29501f, -88.28127f, -88.26777f,
+   -88.2545f, -88.24149f, -88.22874f, -88.21626f, -88.20406f, -88.19214f,
+   -88.18052f, -88.16921f, -88.1582f, -88.1475f, -88.13713f, -88.12709f,
+   -88.11737f, -88.108f, -88.09897f, -88.09029f, -88.08197f, -88.074f,
+   -88.06639f, -88.05914f, -88.05226f, -88.04576f, -88.03963f, -88.03388f,
+   -88.0285f, -88.02352f, -88.01892f, -88.01472f, -88.01091f, -88.00749f,
+   -88.00449f, -88.00189f, -87.99971f, -87.99794f, -87.9966f, -87.99569f,
+   -87.99523f, -87.99521f, -87.99566f, -87.99657f, -87.99797f, -87.99987f,
+   -88.00229f, -88.00524f, -88.00875f, -88.01285f, -88.01756f, -88.02294f,
+   -88.02901f, -88.03583f, -88.04347f},
+  {-88.32802f, -88.31333f, -88.29885f, -88.28458f, -88.27053f, -88.25673f,
+   -88.24317f, -88.22987f, -88.21683f, -88.20407f, -88.1916f, -88.17942f,
+   -88.16754f, -88.15596f, -88.14471f, -88.13378f, -88.12317f, -88.1129f,
+   -88.10297f, -88.09339f, -88.08416f, -88.07528f, -88.06677f, -88.05861f,
+   -88.05083f, -88.04341f, -88.03637f, -88.0297f, -88.02342f, -88.01752f,
+   -88.012f, -88.00688f, -88.00215f, -87.99781f, -87.99387f, -87.99033f,
+   -87.9872f, -87.98448f, -87.98217f, -87.98029f, -87.97882f, -87.97779f,
+   -87.9772f, -87.97706f, -87.97737f, -87.97815f, -87.9794f, -87.98115f,
+   -87.98341f, -87.98619f, -87.98951f, -87.99341f, -87.99791f, -88.00304f,
+   -88.00884f, -88.01536f, -88.02265f},
+  {-88.31864f, -88.30362f, -88.28882f, -88.27423f, -88.25987f, -88.24575f,
+   -88.23189f, -88.21829f, -88.20496f, -88.19191f, -88.17916f, -88.1667f,
+   -88.15456f, -88.14273f, -88.13122f, -88.12004f, -88.1092f, -88.0987f,
+   -88.08855f, -88.07876f, -88.06932f, -88.06024f, -88.05154f, -88.0432f,
+   -88.03524f, -88.02765f, -88.02045f, -88.01362f, -88.00719f, -88.00114f,
+   -87.99549f, -87.99022f, -87.98536f, -87.98089f, -87.97683f, -87.97317f,
+   -87.96992f, -87.96709f, -87.96466f, -87.96266f, -87.96109f, -87.95994f,
+   -87.95923f, -87.95897f, -87.95916f, -87.95981f, -87.96093f, -87.96254f,
+   -87.96465f, -87.96728f, -87.97044f, -87.97415f, -87.97845f, -87.98336f,
+   -87.98892f, -87.99517f, -88.00216f},
+  {-88.30937f, -88.29402f, -88.27888f, -88.26396f, -88.24928f, -88.23484f,
+   -88.22066f, -88.20675f, -88.19312f, -88.17978f, -88.16673f, -88.154f,
+   -88.14158f, -88.12948f, -88.11771f, -88.10629f, -88.09521f, -88.08448f,
+   -88.0741f, -88.06409f, -88.05444f, -88.04517f, -88.03627f, -88.02775f,
+   -88.01961f, -88.01185f, -88.00449f, -87.99751f, -87.99092f, -87.98473f,
+   -87.97894f, -87.97355f, -87.96855f, -87.96396f, -87.95978f, -87.95601f,
+   -87.95264f, -87.9497f, -87.94716f, -87.94506f, -87.94337f, -87.94212f,
+   -87.9413f, -87.94093f, -87.94101f, -87.94154f, -87.94255f, -87.94403f,
+   -87.94601f, -87.94849f, -87.9515f, -87.95505f, -87.95917f, -87.96389f,
+   -87.96923f, -87.97523f, -87.98195f},
+  {-88.30022f, -88.28452f, -88.26903f, -88.25377f, -88.23875f, -88.22398f,
+   -88.20947f, -88.19524f, -88.1813f, -88.16765f, -88.15431f, -88.14129f,
+   -88.12858f, -88.11622f, -88.10419f, -88.09251f, -88.08118f, -88.07021f,
+   -88.05961f, -88.04938f, -88.03952f, -88.03005f, -88.02095f, -88.01225f,
+   -88.00393f, -87.99601f, -87.98848f, -87.98134f, -87.97461f, -87.96828f,
+   -87.96235f, -87.95683f, -87.95171f, -87.947f, -87.94271f, -87.93882f,
+   -87.93535f, -87.9323f, -87.92966f, -87.92745f, -87.92567f, -87.92432f,
+   -87.9234f, -87.92293f, -87.9229f, -87.92333f, -87.92423f, -87.9256f,
+   -87.92745f, -87.92981f, -87.93268f, -87.93609f, -87.94005f, -87.94458f,
+   -87.94973f, -87.95552f, -87.962f},
+  {-88.29118f, -88.27511f, -88.25927f, -88.24365f, -88.22828f, -88.21317f,
+   -88.19832f, -88.18376f, -88.1695f, -88.15553f, -88.14189f, -88.12856f,
+   -88.11557f, -88.10292f, -88.09063f, -88.07868f, -88.06711f, -88.0559f,
+   -88.04506f, -88.03461f, -88.02454f, -88.01486f, -88.00557f, -87.99668f,
+   -87.98819f, -87.9801f, -87.97241f, -87.96512f, -87.95824f, -87.95178f,
+   -87.94572f, -87.94007f, -87.93483f, -87.93001f, -87.9256f, -87.92161f,
+   -87.91803f, -87.91488f, -87.91215f, -87.90985f, -87.90797f, -87.90653f,
+   -87.90552f, -87.90495f, -87.90484f, -87.90517f, -87.90597f, -87.90723f,
+   -87.90898f, -87.91122f, -87.91397f, -87.91724f, -87.92106f, -87.92544f,
+   -87.93041f, -87.93601f, -87.94227f},
+  {-88.28225f, -88.26581f, -88.24959f, -88.2336f, -88.21787f, -88.2024f,
+   -88.1872f, -88.1723f, -88.1577f, -88.14341f, -88.12945f, -88.11582f,
+   -88.10253f, -88.0896f, -88.07702f, -88.06481f, -88.05298f, -88.04152f,
+   -88.03046f, -88.01978f, -88.00949f, -87.99961f, -87.99012f, -87.98105f,
+   -87.97238f, -87.96412f, -87.95627f, -87.94883f, -87.94181f, -87.9352f,
+   -87.92902f, -87.92324f, -87.91789f, -87.91296f, -87.90844f, -87.90435f,
+   -87.90068f, -87.89744f, -87.89462f, -87.89223f, -87.89026f, -87.88874f,
+   -87.88765f, -87.88699f, -87.88679f, -87.88704f, -87.88775f, -87.88892f,
+   -87.89057f, -87.89271f, -87.89535f, -87.8985f, -87.90219f, -87.90643f,
+   -87.91125f, -87.91668f, -87.92274f},
+  {-88.27343f, -88.2566f, -88.23999f, -88.22362f, -88.2075f, -88.19166f,
+   -88.17611f, -88.16085f, -88.14591f, -88.13128f, -88.11699f, -88.10304f,
+   -88.08945f, -88.07622f, -88.06336f, -88.05088f, -88.03878f, -88.02708f,
+   -88.01577f, -88.00486f, -87.99436f, -87.98427f, -87.97459f, -87.96533f,
+   -87.95648f, -87.94805f, -87.94004f, -87.93246f, -87.9253f, -87.91856f,
+   -87.91224f, -87.90635f, -87.90089f, -87.89585f, -87.89123f, -87.88705f,
+   -87.88329f, -87.87995f, -87.87705f, -87.87458f, -87.87254f, -87.87093f,
+   -87.86976f, -87.86904f, -87.86876f, -87.86893f, -87.86956f, -87.87065f,
+   -87.87221f, -87.87426f, -87.8768f, -87.87985f, -87.88343f, -87.88754f,
+   -87.89222f, -87.8975f, -87.90339f},
+  {-88.26473f, -88.24748f, -88.23046f, -88.21369f, -88.19719f, -88.18096f,
+   -88.16503f, -88.14941f, -88.1341f, -88.11913f, -88.1045f, -88.09023f,
+   -88.07632f, -88.06279f, -88.04964f, -88.03688f, -88.02451f, -88.01255f,
+   -88.001f, -87.98986f, -87.97914f, -87.96884f, -87.95896f, -87.94951f,
+   -87.94048f, -87.93189f, -87.92372f, -87.91599f, -87.90869f, -87.90182f,
+   -87.89538f, -87.88938f, -87.88381f, -87.87867f, -87.87396f, -87.86968f,
+   -87.86583f, -87.86242f, -87.85944f, -87.85689f, -87.85478f, -87.85311f,
+   -87.85187f, -87.85108f, -87.85073f, -87.85083f, -87.85139f, -87.85241f,
+   -87.8539f, -87.85586f, -87.85832f, -87.86128f, -87.86475f, -87.86876f,
+   -87.87332f, -87.87846f, -87.8842f},
+  {-88.25613f, -88.23845f, -88.22101f, -88.20382f, -88.18691f, -88.17028f,
+   -88.15396f, -88.13795f, -88.12228f, -88.10695f, -88.09197f, -88.07736f,
+   -88.06313f, -88.04928f, -88.03583f, -88.02279f, -88.01015f, -87.99793f,
+   -87.98613f, -87.97475f, -87.96381f, -87.9533f, -87.94322f, -87.93358f,
+   -87.92438f, -87.91562f, -87.9073f, -87.89942f, -87.89198f, -87.88499f,
+   -87.87843f, -87.87232f, -87.86664f, -87.8614f, -87.8566f, -87.85224f,
+   -87.84831f, -87.84483f, -87.84177f, -87.83916f, -87.83698f, -87.83525f,
+   -87.83395f, -87.8331f, -87.83269f, -87.83273f, -87.83323f, -87.83419f,
+   -87.83561f, -87.83751f, -87.83989f, -87.84277f, -87.84616f, -87.85007f,
+   -87.85452f, -87.85954f, -87.86515f},
+  {-88.24763f, -88.22951f, -88.21163f, -88.19401f, -88.17667f, -88.15962f,
+   -88.14289f, -88.12649f, -88.11043f, -88.09472f, -88.07939f, -88.06443f,
+   -88.04986f, -88.0357f, -88.02194f, -88.0086f, -87.99568f, -87.98319f,
+   -87.97114f, -87.95953f, -87.94836f, -87.93763f, -87.92736f, -87.91753f,
+   -87.90815f, -87.89923f, -87.89075f, -87.88273f, -87.87516f, -87.86804f,
+   -87.86137f, -87.85515f, -87.84937f, -87.84404f, -87.83916f, -87.83472f,
+   -87.83072f, -87.82716f, -87.82405f, -87.82137f, -87.81914f, -87.81735f,
+   -87.816f, -87.8151f, -87.81464f, -87.81463f, -87.81507f, -87.81598f,
+   -87.81735f, -87.81919f, -87.8215f, -87.82431f, -87.82763f, -87.83145f,
+   -87.83582f, -87.84073f, -87.84622f},
+  {-88.23925f, -88.22065f, -88.20231f, -88.18424f, -88.16645f, -88.14897f,
+   -88.13182f, -88.115f, -88.09854f, -88.08245f, -88.06674f, -88.05142f,
+   -88.03651f, -88.02201f, -88.00794f, -87.9943f, -87.9811f, -87.96834f,
+   -87.95603f, -87.94417f, -87.93277f, -87.92184f, -87.91136f, -87.90134f,
+   -87.89179f, -87.8827f, -87.87408f, -87.86592f, -87.85822f, -87.85097f,
+   -87.84419f, -87.83787f, -87.832f, -87.82658f, -87.82162f, -87.8171f,
+   -87.81304f, -87.80942f, -87.80625f, -87.80352f, -87.80124f, -87.7994f,
+   -87.798f, -87.79706f, -87.79656f, -87.79651f, -87.79691f, -87.79777f,
+   -87.79909f, -87.80088f, -87.80315f, -87.8059f, -87.80915f, -87.81291f,
+   -87.81719f, -87.82202f, -87.82741f},
+  {-88.23096f, -88.21188f, -88.19305f, -88.17451f, -88.15626f, -88.13832f,
+   -88.12073f, -88.10348f, -88.0866f, -88.07011f, -88.05401f, -88.03833f,
+   -88.02306f, -88.00822f, -87.99382f, -87.97987f, -87.96638f, -87.95334f,
+   -87.94077f, -87.92867f, -87.91704f, -87.90589f, -87.89521f, -87.88501f,
+   -87.87528f, -87.86603f, -87.85726f, -87.84896f, -87.84113f, -87.83377f,
+   -87.82688f, -87.82046f, -87.8145f, -87.80901f, -87.80397f, -87.79939f,
+   -87.79526f, -87.79159f, -87.78837f, -87.78559f, -87.78327f, -87.78139f,
+   -87.77996f, -87.77898f, -87.77844f, -87.77836f, -87.77873f, -87.77955f,
+   -87.78084f, -87.78259f, -87.78482f, -87.78752f, -87.79072f, -87.79442f,
+   -87.79864f, -87.80339f, -87.80869f},
+  {-88.22278f, -88.20318f, -88.18385f, -88.16481f, -88.14607f, -88.12767f,
+   -88.10961f, -88.09192f, -88.07461f, -88.0577f, -88.0412f, -88.02513f,
+   -88.00949f, -87.9943f, -87.97957f, -87.96531f, -87.95151f, -87.9382f,
+   -87.92536f, -87.91301f, -87.90115f, -87.88978f, -87.8789f, -87.86851f,
+   -87.85861f, -87.8492f, -87.84028f, -87.83184f, -87.82389f, -87.81642f,
+   -87.80943f, -87.80292f, -87.79688f, -87.79131f, -87.7862f, -87.78156f,
+   -87.77738f, -87.77366f, -87.77039f, -87.76758f, -87.76522f, -87.76331f,
+   -87.76185f, -87.76084f, -87.76028f, -87.76017f, -87.76052f, -87.76132f,
+   -87.76258f, -87.7643f, -87.7665f, -87.76917f, -87.77232f, -87.77598f,
+   -87.78014f, -87.78483f, -87.79006f},
+  {-88.2147f, -88.19457f, -88.17471f, -88.15514f, -88.1359f, -88.117f,
+   -88.09846f, -88.0803f, -88.06254f, -88.0452f, -88.02828f, -88.01181f,
+   -87.9958f, -87.98025f, -87.96518f, -87.95059f, -87.93649f, -87.92288f,
+   -87.90978f, -87.89718f, -87.88508f, -87.87349f, -87.86241f, -87.85183f,
+   -87.84176f, -87.83219f, -87.82313f, -87.81456f, -87.80649f, -87.79892f,
+   -87.79183f, -87.78523f, -87.77911f, -87.77347f, -87.7683f, -87.76361f,
+   -87.75938f, -87.75562f, -87.75232f, -87.74948f, -87.74709f, -87.74516f,
+   -87.74368f, -87.74265f, -87.74207f, -87.74195f, -87.74228f, -87.74306f,
+   -87.7443f, -87.74601f, -87.74818f, -87.75083f, -87.75395f, -87.75757f,
+   -87.7617f, -87.76634f, -87.77151f},
+  {-88.20672f, -88.18602f, -88.1656f, -88.14549f, -88.12572f, -88.1063f,
+   -88.08726f, -88.06861f, -88.05038f, -88.03259f, -88.01525f, -87.99836f,
+   -87.98196f, -87.96604f, -87.95061f, -87.93569f, -87.92128f, -87.90738f,
+   -87.894f, -87.88115f, -87.86882f, -87.85701f, -87.84572f, -87.83496f,
+   -87.82472f, -87.815f, -87.80579f, -87.7971f, -87.78892f, -87.78124f,
+   -87.77406f, -87.76738f, -87.76119f, -87.75549f, -87.75027f, -87.74553f,
+   -87.74126f, -87.73747f, -87.73414f, -87.73127f, -87.72887f, -87.72692f,
+   -87.72543f, -87.72439f, -87.72381f, -87.72367f, -87.724f, -87.72477f,
+   -87.72601f, -87.7277f, -87.72986f, -87.73249f, -87.7356f, -87.7392f,
+   -87.74329f, -87.74789f, -87.75302f},
+  {-88.19884f, -88.17755f, -88.15654f, -88.13586f, -88.11553f, -88.09556f,
+   -88.07599f, -88.05684f, -88.03813f, -88.01987f, -88.00207f, -87.98476f,
+   -87.96795f, -87.95165f, -87.93586f, -87.9206f, -87.90587f, -87.89168f,
+   -87.87802f, -87.86491f, -87.85234f, -87.84031f, -87.82883f, -87.81788f,
+   -87.80748f, -87.7976f, -87.78826f, -87.77945f, -87.77115f, -87.76338f,
+   -87.75611f, -87.74936f, -87.74311f, -87.73735f, -87.73208f, -87.7273f,
+   -87.72301f, -87.71919f, -87.71584f, -87.71296f, -87.71054f, -87.70859f,
+   -87.70709f, -87.70606f, -87.70547f, -87.70534f, -87.70567f, -87.70645f,
+   -87.70768f, -87.70938f, -87.71154f, -87.71416f, -87.71726f, -87.72084f,
+   -87.72492f, -87.7295f, -87.73459f},
+  {-88.19106f, -88.16914f, -88.14752f, -88.12623f, -88.10531f, -88.08478f,
+   -88.06466f, -88.04498f, -88.02575f, -88.007f, -87.98875f, -87.971f,
+   -87.95377f, -87.93707f, -87.92091f, -87.9053f, -87.89025f, -87.87575f,
+   -87.86182f, -87.84844f, -87.83563f, -87.82339f, -87.8117f, -87.80058f,
+   -87.79001f, -87.77999f, -87.77051f, -87.76158f, -87.75318f, -87.74532f,
+   -87.73798f, -87.73116f, -87.72485f, -87.71904f, -87.71374f, -87.70893f,
+   -87.70461f, -87.70077f, -87.69741f, -87.69453f, -87.69211f, -87.69016f,
+   -87.68867f, -87.68764f, -87.68707f, -87.68695f, -87.68729f, -87.68808f,
+   -87.68932f, -87.69103f, -87.69319f, -87.69582f, -87.69893f, -87.70251f,
+   -87.70657f, -87.71114f, -87.71621f},
+  {-88.18337f, -88.16078f, -88.13852f, -88.1166f, -88.09506f, -88.07393f,
+   -88.05324f, -88.033f, -88.01325f, -87.99399f, -87.97525f, -87.95704f,
+   -87.93938f, -87.92228f, -87.90574f, -87.88977f, -87.87439f, -87.85958f,
+   -87.84536f, -87.83173f, -87.81868f, -87.80622f, -87.79433f, -87.78303f,
+   -87.7723f, -87.76213f, -87.75253f, -87.74349f, -87.735f, -87.72705f,
+   -87.71964f, -87.71276f, -87.7064f, -87.70056f, -87.69522f, -87.69039f,
+   -87.68606f, -87.68221f, -87.67885f, -87.67597f, -87.67356f, -87.67162f,
+   -87.67015f, -87.66914f, -87.66858f, -87.66848f, -87.66884f, -87.66965f,
+   -87.67092f, -87.67265f, -87.67483f, -87.67748f, -87.68059f, -87.68418f,
+   -87.68825f, -87.69281f, -87.69787f},
+  {-88.17578f, -88.15249f, -88.12953f, -88.10695f, -88.08476f, -88.06301f,
+   -88.04171f, -88.02089f, -88.00058f, -87.9808f, -87.96156f, -87.94288f,
+   -87.92477f, -87.90725f, -87.89032f, -87.87399f, -87.85826f, -87.84315f,
+   -87.82864f, -87.81475f, -87.80146f, -87.78878f, -87.7767f, -87.76522f,
+   -87.75433f, -87.74403f, -87.73431f, -87.72516f, -87.71658f, -87.70856f,
+   -87.70108f, -87.69415f, -87.68775f, -87.68188f, -87.67653f, -87.67168f,
+   -87.66735f, -87.6635f, -87.66015f, -87.65728f, -87.65489f, -87.65297f,
+   -87.65152f, -87.65054f, -87.65001f, -87.64994f, -87.65033f, -87.65118f,
+   -87.65247f, -87.65423f, -87.65644f, -87.65911f, -87.66224f, -87.66585f,
+   -87.66993f, -87.6745f, -87.67957f},
+  {-88.16827f, -88.14424f, -88.12056f, -88.09727f, -88.0744f, -88.05199f,
+   -88.03006f, -88.00863f, -87.98774f, -87.96741f, -87.94765f, -87.92848f,
+   -87.90991f, -87.89196f, -87.87462f, -87.85792f, -87.84186f, -87.82642f,
+   -87.81163f, -87.79747f, -87.78395f, -87.77105f, -87.75878f, -87.74713f,
+   -87.73609f, -87.72566f, -87.71583f, -87.70658f, -87.69792f, -87.68983f,
+   -87.6823f, -87.67533f, -87.6689f, -87.66301f, -87.65764f, -87.6528f,
+   -87.64846f, -87.64463f, -87.6413f, -87.63845f, -87.63609f, -87.6342f,
+   -87.63279f, -87.63184f, -87.63135f, -87.63132f, -87.63175f, -87.63264f,
+   -87.63397f, -87.63577f, -87.63801f, -87.64072f, -87.64389f, -87.64752f,
+   -87.65163f, -87.65621f, -87.66129f},
+  {-88.16084f, -88.13603f, -88.11159f, -88.08756f, -88.06397f, -88.04086f,
+   -88.01826f, -87.9962f, -87.97471f, -87.9538f, -87.9335f, -87.91382f,
+   -87.89478f, -87.87638f, -87.85864f, -87.84156f, -87.82514f, -87.80939f,
+   -87.7943f, -87.77988f, -87.76612f, -87.75302f, -87.74056f, -87.72874f,
+   -87.71756f, -87.70701f, -87.69707f, -87.68773f, -87.679f, -87.67085f,
+   -87.66328f, -87.65627f, -87.64982f, -87.64392f, -87.63856f, -87.63372f,
+   -87.6294f, -87.62559f, -87.62229f, -87.61947f, -87.61715f, -87.6153f,
+   -87.61393f, -87.61303f, -87.61259f, -87.61261f, -87.61309f, -87.61403f,
+   -87.61542f, -87.61726f, -87.61955f, -87.6223f, -87.62551f, -87.62918f,
+   -87.63332f, -87.63794f, -87.64304f},
+  {-88.1535f, -88.12786f, -88.1026f, -88.07778f, -88.05344f, -88.0296f,
+   -88.0063f, -87.98357f, -87.96145f, -87.93994f, -87.91908f, -87.89887f,
+   -87.87934f, -87.86049f, -87.84232f, -87.82486f, -87.80809f, -87.79202f,
+   -87.77664f, -87.76196f, -87.74796f, -87.73465f, -87.72201f, -87.71004f,
+   -87.69872f, -87.68805f, -87.67801f, -87.6686f, -87.6598f, -87.65161f,
+   -87.644f, -87.63697f, -87.63052f, -87.62462f, -87.61926f, -87.61444f,
+   -87.61015f, -87.60638f, -87.60311f, -87.60034f, -87.59806f, -87.59627f,
+   -87.59496f, -87.59411f, -87.59373f, -87.59382f, -87.59436f, -87.59535f,
+   -87.5968f, -87.5987f, -87.60105f, -87.60386f, -87.60712f, -87.61084f,
+   -87.61502f, -87.61968f, -87.62481f},
+  {-88.14623f, -88.1197f, -88.09359f, -88.06794f, -88.04279f, -88.01818f,
+   -87.99415f, -87.97072f, -87.94793f, -87.92581f, -87.90436f, -87.88361f,
+   -87.86357f, -87.84425f, -87.82566f, -87.8078f, -87.79067f, -87.77428f,
+   -87.75861f, -87.74367f, -87.72945f, -87.71593f, -87.70312f, -87.69099f,
+   -87.67955f, -87.66877f, -87.65865f, -87.64917f, -87.64032f, -87.63208f,
+   -87.62446f, -87.61742f, -87.61097f, -87.60508f, -87.59975f, -87.59496f,
+   -87.59071f, -87.58698f, -87.58376f, -87.58105f, -87.57883f, -87.5771f,
+   -87.57585f, -87.57508f, -87.57477f, -87.57492f, -87.57553f, -87.5766f,
+   -87.57812f, -87.58009f, -87.5825f, -87.58537f, -87.5887f, -87.59247f,
+   -87.59671f, -87.60142f, -87.6066f},
+  {-88.13902f, -88.11156f, -88.08453f, -88.058f, -88.032f, -88.00658f,
+   -87.98177f, -87.95761f, -87.93413f, -87.91136f, -87.8893f, -87.86799f,
+   -87.84743f, -87.82763f, -87.80861f, -87.79035f, -87.77286f, -87.75614f,
+   -87.74019f, -87.72499f, -87.71054f, -87.69683f, -87.68385f, -87.67158f,
+   -87.66002f, -87.64915f, -87.63895f, -87.62941f, -87.62052f, -87.61227f,
+   -87.60463f, -87.5976f, -87.59116f, -87.5853f, -87.58f, -87.57526f,
+   -87.57106f, -87.56739f, -87.56423f, -87.56159f, -87.55944f, -87.55779f,
+   -87.55662f, -87.55592f, -87.55569f, -87.55593f, -87.55662f, -87.55777f,
+   -87.55937f, -87.56141f, -87.56391f, -87.56685f, -87.57025f, -87.57409f,
+   -87.5784f, -87.58316f, -87.58839f},
+  {-88.13187f, -88.10341f, -88.07541f, -88.04794f, -88.02105f, -87.99477f,
+   -87.96915f, -87.94422f, -87.92002f, -87.89656f, -87.87388f, -87.85199f,
+   -87.83089f, -87.8106f, -87.79113f, -87.77247f, -87.75462f, -87.73758f,
+   -87.72134f, -87.70589f, -87.69123f, -87.67733f, -87.66419f, -87.65179f,
+   -87.64012f, -87.62917f, -87.61891f, -87.60933f, -87.60041f, -87.59215f,
+   -87.58451f, -87.5775f, -87.57109f, -87.56527f, -87.56002f, -87.55534f,
+   -87.5512f, -87.5476f, -87.54452f, -87.54195f, -87.53989f, -87.53833f,
+   -87.53724f, -87.53664f, -87.5365f, -87.53683f, -87.53761f, -87.53885f,
+   -87.54054f, -87.54268f, -87.54526f, -87.54829f, -87.55177f, -87.55569f,
+   -87.56007f, -87.5649f, -87.5702f},
+  {-88.12477f, -88.09524f, -88.06621f, -88.03775f, -88.0099f, -87.98271f,
+   -87.95623f, -87.9305f, -87.90554f, -87.88138f, -87.85805f, -87.83555f,
+   -87.81391f, -87.79312f, -87.77319f, -87.75413f, -87.73592f, -87.71856f,
+   -87.70204f, -87.68635f, -87.67147f, -87.6574f, -87.64411f, -87.63159f,
+   -87.61983f, -87.60881f, -87.5985f, -87.58889f, -87.57996f, -87.5717f,
+   -87.56409f, -87.55711f, -87.55074f, -87.54498f, -87.53979f, -87.53518f,
+   -87.53112f, -87.5276f, -87.52461f, -87.52214f, -87.52018f, -87.51871f,
+   -87.51773f, -87.51722f, -87.51719f, -87.51762f, -87.51851f, -87.51985f,
+   -87.52165f, -87.52388f, -87.52656f, -87.52969f, -87.53325f, -87.53727f,
+   -87.54173f, -87.54664f, -87.55201f},
+  {-88.11771f, -88.08703f, -88.0569f, -88.02738f, -87.99852f, -87.97037f,
+   -87.94299f, -87.91641f, -87.89066f, -87.86577f, -87.84176f, -87.81864f,
+   -87.79644f, -87.77514f, -87.75476f, -87.73528f, -87.71671f, -87.69904f,
+   -87.68224f, -87.66632f, -87.65124f, -87.63701f, -87.62359f, -87.61097f,
+   -87.59912f, -87.58804f, -87.5777f, -87.56808f, -87.55916f, -87.55092f,
+   -87.54335f, -87.53642f, -87.53011f, -87.52441f, -87.51931f, -87.51478f,
+   -87.51081f, -87.50739f, -87.50451f, -87.50215f, -87.50029f, -87.49894f,
+   -87.49807f, -87.49768f, -87.49776f, -87.49831f, -87.49931f, -87.50077f,
+   -87.50267f, -87.50502f, -87.50781f, -87.51104f, -87.5147f, -87.51881f,
+   -87.52337f, -87.52837f, -87.53382f},
+  {-88.11066f, -88.07876f, -88.04745f, -88.0168f, -87.98687f, -87.95771f,
+   -87.92937f, -87.9019f, -87.87532f, -87.84967f, -87.82496f, -87.80122f,
+   -87.77843f, -87.75662f, -87.73578f, -87.7159f, -87.69697f, -87.67898f,
+   -87.66192f, -87.64577f, -87.63051f, -87.61613f, -87.60259f, -87.58988f,
+   -87.57798f, -87.56686f, -87.55651f, -87.54689f, -87.538f, -87.5298f,
+   -87.52227f, -87.51541f, -87.50918f, -87.50357f, -87.49856f, -87.49413f,
+   -87.49028f, -87.48697f, -87.4842f, -87.48196f, -87.48023f, -87.479f,
+   -87.47826f, -87.478f, -87.47821f, -87.47888f, -87.48002f, -87.4816f,
+   -87.48362f, -87.48609f, -87.489f, -87.49234f, -87.49612f, -87.50034f,
+   -87.50499f, -87.51009f, -87.51564f},
+  {-88.10361f, -88.0704f, -88.03783f, -88.00598f, -87.9749f, -87.94467f,
+   -87.91533f, -87.88692f, -87.85948f, -87.83304f, -87.80761f, -87.78321f,
+   -87.75984f, -87.73751f, -87.7162f, -87.69592f, -87.67664f, -87.65835f,
+   -87.64104f, -87.62468f, -87.60925f, -87.59473f, -87.58109f, -87.56832f,
+   -87.55637f, -87.54524f, -87.53489f, -87.5253f, -87.51645f, -87.50831f,
+   -87.50086f, -87.49408f, -87.48794f, -87.48244f, -87.47754f, -87.47323f,
+   -87.4695f, -87.46633f, -87.46369f, -87.46159f, -87.45999f, -87.4589f,
+   -87.4583f, -87.45818f, -87.45853f, -87.45935f, -87.46062f, -87.46233f,
+   -87.46449f, -87.46709f, -87.47013f, -87.4736f, -87.4775f, -87.48183f,
+   -87.4866f, -87.49181f, -87.49746f},
+  {-88.09653f, -88.06191f, -88.028f, -87.99486f, -87.96257f, -87.9312f,
+   -87.9008f, -87.87141f, -87.84308f, -87.81581f, -87.78964f, -87.76457f,
+   -87.74061f, -87.71775f, -87.69598f, -87.6753f, -87.65568f, -87.6371f,
+   -87.61955f, -87.603f, -87.58742f, -87.57279f, -87.55907f, -87.54625f,
+   -87.53428f, -87.52315f, -87.51283f, -87.50329f, -87.4945f, -87.48644f,
+   -87.47908f, -87.47241f, -87.46639f, -87.46101f, -87.45624f, -87.45207f,
+   -87.44848f, -87.44545f, -87.44297f, -87.44101f, -87.43957f, -87.43864f,
+   -87.43819f, -87.43823f, -87.43873f, -87.4397f, -87.44111f, -87.44298f,
+   -87.44528f, -87.44803f, -87.4512f, -87.4548f, -87.45884f, -87.4633f,
+   -87.46819f, -87.47352f, -87.47928f},
+  {-88.0894f, -88.05327f, -88.0179f, -87.98339f, -87.94981f, -87.91724f,
+   -87.88572f, -87.85531f, -87.82603f, -87.79792f, -87.77098f, -87.74523f,
+   -87.72067f, -87.69728f, -87.67506f, -87.65398f, -87.63404f, -87.61519f,
+   -87.59742f, -87.5807f, -87.56499f, -87.55027f, -87.53649f, -87.52365f,
+   -87.51169f, -87.50059f, -87.49032f, -87.48084f, -87.47214f, -87.46419f,
+   -87.45695f, -87.4504f, -87.44451f, -87.43928f, -87.43466f, -87.43065f,
+   -87.42722f, -87.42435f, -87.42203f, -87.42024f, -87.41897f, -87.41821f,
+   -87.41793f, -87.41813f, -87.4188f, -87.41993f, -87.42151f, -87.42353f,
+   -87.426f, -87.42889f, -87.43222f, -87.43597f, -87.44014f, -87.44474f,
+   -87.44977f, -87.45522f, -87.4611f},
+  {-88.08218f, -88.04441f, -88.00749f, -87.97151f, -87.93656f, -87.90271f,
+   -87.87001f, -87.83852f, -87.80827f, -87.77928f, -87.75156f, -87.72512f,
+   -87.69995f, -87.67604f, -87.65337f, -87.63193f, -87.61167f, -87.59257f,
+   -87.5746f, -87.55773f, -87.54192f, -87.52713f, -87.51333f, -87.50049f,
+   -87.48856f, -87.47752f, -87.46732f, -87.45795f, -87.44936f, -87.44153f,
+   -87.43443f, -87.42803f, -87.42231f, -87.41723f, -87.41279f, -87.40895f,
+   -87.4057f, -87.40302f, -87.40088f, -87.39928f, -87.39819f, -87.39761f,
+   -87.39751f, -87.39789f, -87.39874f, -87.40005f, -87.4018f, -87.404f,
+   -87.40663f, -87.40969f, -87.41317f, -87.41708f, -87.42141f, -87.42615f,
+   -87.43132f, -87.43691f, -87.44293f},
+  {-88.07482f, -88.03529f, -87.99669f, -87.95914f, -87.92273f, -87.88752f,
+   -87.85359f, -87.82097f, -87.78971f, -87.75982f, -87.7313f, -87.70416f,
+   -87.67839f, -87.65397f, -87.63087f, -87.60906f, -87.58851f, -87.56919f,
+   -87.55105f, -87.53406f, -87.51818f, -87.50336f, -87.48956f, -87.47675f,
+   -87.46488f, -87.45392f, -87.44384f, -87.43459f, -87.42614f, -87.41846f,
+   -87.41153f, -87.4053f, -87.39976f, -87.39488f, -87.39062f, -87.38698f,
+   -87.38393f, -87.38144f, -87.37951f, -87.37811f, -87.37722f, -87.37684f,
+   -87.37694f, -87.37752f, -87.37856f, -87.38006f, -87.382f, -87.38438f,
+   -87.38719f, -87.39042f, -87.39408f, -87.39815f, -87.40264f, -87.40754f,
+   -87.41286f, -87.4186f, -87.42475f},
+  {-88.06728f, -88.02584f, -87.98544f, -87.9462f, -87.90823f, -87.87159f,
+   -87.83635f, -87.80256f, -87.77025f, -87.73943f, -87.71011f, -87.68227f,
+   -87.6559f, -87.63098f, -87.60747f, -87.58532f, -87.56452f, -87.545f,
+   -87.52672f, -87.50965f, -87.49372f, -87.4789f, -87.46514f, -87.4524f,
+   -87.44063f, -87.42979f, -87.41984f, -87.41075f, -87.40247f, -87.39498f,
+   -87.38823f, -87.38221f, -87.37687f, -87.3722f, -87.36816f, -87.36474f,
+   -87.3619f, -87.35964f, -87.35792f, -87.35674f, -87.35607f, -87.3559f,
+   -87.35621f, -87.357f, -87.35825f, -87.35995f, -87.36209f, -87.36467f,
+   -87.36767f, -87.37109f, -87.37493f, -87.37918f, -87.38384f, -87.38891f,
+   -87.39438f, -87.40028f, -87.40658f},
+  {-88.05948f, -88.01597f, -87.97363f, -87.93258f, -87.89294f, -87.85479f,
+   -87.81818f, -87.78317f, -87.74978f, -87.71802f, -87.68789f, -87.65935f,
+   -87.6324f, -87.607f, -87.5831f, -87.56065f, -87.53962f, -87.51994f,
+   -87.50157f, -87.48444f, -87.46852f, -87.45374f, -87.44006f, -87.42742f,
+   -87.41578f, -87.4051f, -87.39532f, -87.38642f, -87.37834f, -87.37106f,
+   -87.36454f, -87.35874f, -87.35363f, -87.3492f, -87.3454f, -87.34221f,
+   -87.33962f, -87.33759f, -87.33612f, -87.33517f, -87.33473f, -87.33479f,
+   -87.33534f, -87.33635f, -87.33782f, -87.33974f, -87.34209f, -87.34487f,
+   -87.34808f, -87.35169f, -87.35572f, -87.36016f, -87.365f, -87.37025f,
+   -87.3759f, -87.38195f, -87.38841f},
+  {-88.05135f, -88.00559f, -87.96115f, -87.91817f, -87.87675f, -87.837f,
+   -87.79896f, -87.76268f, -87.72819f, -87.69547f, -87.66452f, -87.63531f,
+   -87.6078f, -87.58194f, -87.55769f, -87.53498f, -87.51376f, -87.49397f,
+   -87.47554f, -87.45841f, -87.44253f, -87.42784f, -87.41427f, -87.40178f,
+   -87.39032f, -87.37983f, -87.37026f, -87.36158f, -87.35374f, -87.3467f,
+   -87.34043f, -87.33489f, -87.33004f, -87.32587f, -87.32233f, -87.31941f,
+   -87.31708f, -87.31531f, -87.31409f, -87.3134f, -87.31322f, -87.31353f,
+   -87.31431f, -87.31557f, -87.31727f, -87.31942f, -87.32199f, -87.325f,
+   -87.32841f, -87.33224f, -87.33647f, -87.34111f, -87.34614f, -87.35157f,
+   -87.3574f, -87.36363f, -87.37026f},
+  {-88.04279f, -87.99459f, -87.94787f, -87.90281f, -87.85951f, -87.81806f,
+   -87.77853f, -87.74095f, -87.70532f, -87.67165f, -87.63989f, -87.61002f,
+   -87.58198f, -87.55571f, -87.53115f, -87.50823f, -87.48687f, -87.46702f,
+   -87.44859f, -87.43151f, -87.41573f, -87.40117f, -87.38777f, -87.37547f,
+   -87.36422f, -87.35397f, -87.34465f, -87.33623f, -87.32866f, -87.3219f,
+   -87.31591f, -87.31066f, -87.3061f, -87.30222f, -87.29897f, -87.29633f,
+   -87.29428f, -87.2928f, -87.29186f, -87.29144f, -87.29152f, -87.2921f,
+   -87.29314f, -87.29465f, -87.2966f, -87.29899f, -87.30181f, -87.30504f,
+   -87.30868f, -87.31273f, -87.31718f, -87.32202f, -87.32725f, -87.33288f,
+   -87.33889f, -87.3453f, -87.35211f},
+  {-88.03368f, -87.98281f, -87.93364f, -87.88634f, -87.84103f, -87.79781f,
+   -87.75672f, -87.7178f, -87.68103f, -87.64641f, -87.61387f, -87.58338f,
+   -87.55485f, -87.52822f, -87.50341f, -87.48033f, -87.4589f, -87.43904f,
+   -87.42066f, -87.4037f, -87.38806f, -87.37369f, -87.36051f, -87.34846f,
+   -87.33748f, -87.3275f, -87.31848f, -87.31036f, -87.3031f, -87.29666f,
+   -87.29098f, -87.28605f, -87.28181f, -87.27824f, -87.2753f, -87.27298f,
+   -87.27124f, -87.27006f, -87.26941f, -87.26929f, -87.26966f, -87.27051f,
+   -87.27183f, -87.27361f, -87.27583f, -87.27847f, -87.28154f, -87.28501f,
+   -87.28889f, -87.29317f, -87.29784f, -87.3029f, -87.30834f, -87.31417f,
+   -87.32038f, -87.32698f, -87.33397f},
+  {-88.02387f, -87.97009f, -87.91826f, -87.86856f, -87.82112f, -87.77603f,
+   -87.73334f, -87.69305f, -87.65515f, -87.61959f, -87.58631f, -87.55524f,
+   -87.52629f, -87.49936f, -87.47437f, -87.4512f, -87.42976f, -87.40997f,
+   -87.39172f, -87.37493f, -87.35951f, -87.34539f, -87.33249f, -87.32074f,
+   -87.31007f, -87.30042f, -87.29174f, -87.28397f, -87.27706f, -87.27096f,
+   -87.26564f, -87.26105f, -87.25716f, -87.25394f, -87.25134f, -87.24936f,
+   -87.24794f, -87.24709f, -87.24676f, -87.24695f, -87.24762f, -87.24878f,
+   -87.25039f, -87.25245f, -87.25494f, -87.25786f, -87.26118f, -87.26492f,
+   -87.26904f, -87.27356f, -87.27847f, -87.28375f, -87.28942f, -87.29546f,
+   -87.30188f, -87.30867f, -87.31585f},
+  {-88.01317f, -87.9562f, -87.90149f, -87.84922f, -87.79953f, -87.7525f,
+   -87.70816f, -87.6665f, -87.62748f, -87.59103f, -87.55706f, -87.52549f,
+   -87.49618f, -87.46904f, -87.44394f, -87.42077f, -87.39941f, -87.37976f,
+   -87.36172f, -87.34518f, -87.33005f, -87.31624f, -87.30368f, -87.29229f,
+   -87.28199f, -87.27272f, -87.26443f, -87.25704f, -87.25052f, -87.24482f,
+   -87.23989f, -87.23568f, -87.23217f, -87.22932f, -87.2271f, -87.22547f,
+   -87.22441f, -87.2239f, -87.22391f, -87.22443f, -87.22543f, -87.2269f,
+   -87.22882f, -87.23117f, -87.23396f, -87.23715f, -87.24076f, -87.24476f,
+   -87.24914f, -87.25391f, -87.25906f, -87.26458f, -87.27048f, -87.27674f,
+   -87.28337f, -87.29038f, -87.29776f},
+  {-88.00135f, -87.9409f, -87.88307f, -87.82805f, -87.77599f, -87.72694f,
+   -87.68093f, -87.6379f, -87.5978f, -87.56053f, -87.52595f, -87.49396f,
+   -87.4644f, -87.43714f, -87.41203f, -87.38896f, -87.36778f, -87.34837f,
+   -87.33061f, -87.3144f, -87.29964f, -87.28622f, -87.27407f, -87.2631f,
+   -87.25323f, -87.2444f, -87.23654f, -87.22959f, -87.22351f, -87.21823f,
+   -87.21373f, -87.20994f, -87.20684f, -87.20439f, -87.20256f, -87.20132f,
+   -87.20064f, -87.2005f, -87.20087f, -87.20174f, -87.20308f, -87.20488f,
+   -87.20712f, -87.20979f, -87.21288f, -87.21637f, -87.22026f, -87.22454f,
+   -87.2292f, -87.23423f, -87.23963f, -87.2454f, -87.25153f, -87.25802f,
+   -87.26488f, -87.2721f, -87.27969f},
+  {-87.98813f, -87.92385f, -87.86264f, -87.8047f, -87.75015f, -87.69904f,
+   -87.65135f, -87.60701f, -87.5659f, -87.52788f, -87.49281f, -87.46051f,
+   -87.43081f, -87.40355f, -87.37857f, -87.3557f, -87.3348f, -87.31573f,
+   -87.29837f, -87.28258f, -87.26827f, -87.25532f, -87.24365f, -87.23316f,
+   -87.22379f, -87.21545f, -87.20808f, -87.20162f, -87.19601f, -87.19121f,
+   -87.18717f, -87.18383f, -87.18118f, -87.17916f, -87.17776f, -87.17693f,
+   -87.17665f, -87.1769f, -87.17765f, -87.17888f, -87.18058f, -87.18273f,
+   -87.18531f, -87.18831f, -87.19172f, -87.19552f, -87.19971f, -87.20428f,
+   -87.20921f, -87.21452f, -87.22018f, -87.22621f, -87.23258f, -87.23932f,
+   -87.2464f, -87.25385f, -87.26165f},
+  {-87.97313f, -87.90466f, -87.83979f, -87.77875f, -87.72162f, -87.66843f,
+   -87.6191f, -87.57351f, -87.5315f, -87.49288f, -87.45744f, -87.42498f,
+   -87.39529f, -87.36818f, -87.34345f, -87.32092f, -87.30043f, -87.28182f,
+   -87.26495f, -87.24969f, -87.23591f, -87.22352f, -87.21241f, -87.20248f,
+   -87.19366f, -87.18588f, -87.17905f, -87.17313f, -87.16805f, -87.16376f,
+   -87.16022f, -87.15737f, -87.1552f, -87.15365f, -87.15269f, -87.1523f,
+   -87.15244f, -87.1531f, -87.15426f, -87.15588f, -87.15796f, -87.16047f,
+   -87.1634f, -87.16674f, -87.17048f, -87.1746f, -87.1791f, -87.18397f,
+   -87.1892f, -87.19479f, -87.20072f, -87.20701f, -87.21364f, -87.22062f,
+   -87.22795f, -87.23562f, -87.24364f},
+  {-87.9559f, -87.88282f, -87.81402f, -87.74971f, -87.68994f, -87.63468f,
+   -87.5838f, -87.53709f, -87.49433f, -87.45527f, -87.41966f, -87.38722f,
+   -87.35772f, -87.33092f, -87.30661f, -87.28457f, -87.26462f, -87.2466f,
+   -87.23034f, -87.21571f, -87.20258f, -87.19082f, -87.18035f, -87.17106f,
+   -87.16287f, -87.15569f, -87.14947f, -87.14413f, -87.13962f, -87.13589f,
+   -87.13289f, -87.13058f, -87.12891f, -87.12785f, -87.12737f, -87.12744f,
+   -87.12804f, -87.12913f, -87.13071f, -87.13273f, -87.1352f, -87.1381f,
+   -87.1414f, -87.1451f, -87.14918f, -87.15363f, -87.15845f, -87.16363f,
+   -87.16917f, -87.17504f, -87.18126f, -87.18782f, -87.19472f, -87.20195f,
+   -87.20952f, -87.21743f, -87.22568f},
+  {-87.93584f, -87.85771f, -87.7847f, -87.71698f, -87.65457f, -87.59733f,
+   -87.54503f, -87.4974f, -87.45411f, -87.41484f, -87.37927f, -87.34708f,
+   -87.31797f, -87.29169f, -87.26797f, -87.24659f, -87.22734f, -87.21005f,
+   -87.19453f, -87.18064f, -87.16825f, -87.15724f, -87.14749f, -87.13891f,
+   -87.13141f, -87.12491f, -87.11935f, -87.11465f, -87.11076f, -87.10763f,
+   -87.10521f, -87.10345f, -87.10233f, -87.10179f, -87.10182f, -87.10238f,
+   -87.10345f, -87.105f, -87.10701f, -87.10946f, -87.11234f, -87.11563f,
+   -87.11931f, -87.12338f, -87.12782f, -87.13262f, -87.13777f, -87.14327f,
+   -87.14912f, -87.15529f, -87.1618f, -87.16864f, -87.17581f, -87.1833f,
+   -87.19113f, -87.19928f, -87.20777f},
+  {-87.91219f, -87.82852f, -87.75104f, -87.67986f, -87.61486f, -87.55581f,
+   -87.50234f, -87.45405f, -87.41052f, -87.37134f, -87.33609f, -87.30441f,
+   -87.27595f, -87.2504f, -87.22749f, -87.20695f, -87.18857f, -87.17215f,
+   -87.15751f, -87.14449f, -87.13295f, -87.12277f, -87.11384f, -87.10605f,
+   -87.09932f, -87.09356f, -87.08871f, -87.0847f, -87.08148f, -87.07899f,
+   -87.07719f, -87.07603f, -87.07547f, -87.07549f, -87.07605f, -87.07713f,
+   -87.07869f, -87.08071f, -87.08318f, -87.08608f, -87.08938f, -87.09308f,
+   -87.09716f, -87.10161f, -87.10642f, -87.11157f, -87.11707f, -87.1229f,
+   -87.12906f, -87.13555f, -87.14236f, -87.14949f, -87.15693f, -87.16469f,
+   -87.17277f, -87.18118f, -87.18991f},
+  {-87.88393f, -87.79425f, -87.7121f, -87.63747f, -87.57009f, -87.50951f,
+   -87.45522f, -87.40666f, -87.36327f, -87.32453f, -87.28995f, -87.25909f,
+   -87.23156f, -87.20701f, -87.18512f, -87.16564f, -87.14831f, -87.13292f,
+   -87.1193f, -87.10728f, -87.0967f, -87.08746f, -87.07942f, -87.0725f,
+   -87.06661f, -87.06166f, -87.05758f, -87.05431f, -87.0518f, -87.05f,
+   -87.04885f, -87.04832f, -87.04837f, -87.04897f, -87.05009f, -87.0517f,
+   -87.05377f, -87.0563f, -87.05924f, -87.0626f, -87.06634f, -87.07047f,
+   -87.07495f, -87.0798f, -87.08498f, -87.09051f, -87.09636f, -87.10253f,
+   -87.10902f, -87.11582f, -87.12294f, -87.13036f, -87.13809f, -87.14613f,
+   -87.15447f, -87.16313f, -87.17211f},
+  {-87.84972f, -87.75358f, -87.66669f, -87.58881f, -87.5194f, -87.45777f,
+   -87.40317f, -87.35484f, -87.31207f, -87.27422f, -87.24071f, -87.21103f,
+   -87.18475f, -87.16147f, -87.14087f, -87.12265f, -87.10656f, -87.09239f,
+   -87.07993f, -87.06903f, -87.05953f, -87.05132f, -87.04428f, -87.03831f,
+   -87.03332f, -87.02924f, -87.02599f, -87.02352f, -87.02176f, -87.02068f,
+   -87.02023f, -87.02036f, -87.02105f, -87.02225f, -87.02395f, -87.02612f,
+   -87.02873f, -87.03177f, -87.03521f, -87.03903f, -87.04324f, -87.0478f,
+   -87.05271f, -87.05796f, -87.06353f, -87.06943f, -87.07564f, -87.08217f,
+   -87.08899f, -87.09612f, -87.10355f, -87.11127f, -87.11929f, -87.12761f,
+   -87.13623f, -87.14515f, -87.15438f},
+  {-87.80778f, -87.70483f, -87.61334f, -87.53267f, -87.46187f, -87.39989f,
+   -87.34566f, -87.29822f, -87.25666f, -87.22023f, -87.18826f, -87.16018f,
+   -87.1355f, -87.11381f, -87.09475f, -87.07803f, -87.06338f, -87.05058f,
+   -87.03944f, -87.02979f, -87.02149f, -87.01442f, -87.00846f, -87.00351f,
+   -86.9995f, -86.99634f, -86.99398f, -86.99235f, -86.99139f, -86.99107f,
+   -86.99135f, -86.99217f, -86.99352f, -86.99536f, -86.99767f, -87.00042f,
+   -87.00358f, -87.00715f, -87.0111f, -87.01541f, -87.02008f, -87.02509f,
+   -87.03044f, -87.0361f, -87.04208f, -87.04836f, -87.05494f, -87.06182f,
+   -87.06899f, -87.07645f, -87.0842f, -87.09223f, -87.10055f, -87.10915f,
+   -87.11805f, -87.12724f, -87.13672f},
+  {-87.75563f, -87.64584f, -87.55029f, -87.46769f, -87.3965f, -87.33515f,
+   -87.28222f, -87.23649f, -87.19687f, -87.16248f, -87.13258f, -87.10654f,
+   -87.08384f, -87.06406f, -87.04682f, -87.03183f, -87.01882f, -87.00757f,
+   -86.9979f, -86.98964f, -86.98264f, -86.9768f, -86.972f, -86.96816f,
+   -86.96519f, -86.96302f, -86.96159f, -86.96084f, -86.96073f, -86.96121f,
+   -86.96224f, -86.96379f, -86.96583f, -86.96833f, -86.97126f, -86.97461f,
+   -86.97834f, -86.98246f, -86.98693f, -86.99175f, -86.9969f, -87.00237f,
+   -87.00816f, -87.01425f, -87.02063f, -87.02731f, -87.03427f, -87.04152f,
+   -87.04904f, -87.05683f, -87.0649f, -87.07325f, -87.08187f, -87.09077f,
+   -87.09995f, -87.10941f, -87.11915f},
+  {-87.68992f, -87.57384f, -87.47547f, -87.39242f, -87.3223f, -87.26293f,
+   -87.21248f, -87.16944f, -87.1326f, -87.10094f, -87.07368f, -87.05016f,
+   -87.02985f, -87.01231f, -86.99718f, -86.98415f, -86.97298f, -86.96346f,
+   -86.95539f, -86.94864f, -86.94306f, -86.93854f, -86.93499f, -86.93232f,
+   -86.93045f, -86.92932f, -86.92887f, -86.92905f, -86.92982f, -86.93113f,
+   -86.93295f, -86.93525f, -86.938f, -86.94118f, -86.94476f, -86.94872f,
+   -86.95305f, -86.95772f, -86.96273f, -86.96806f, -86.97371f, -86.97965f,
+   -86.98589f, -86.99241f, -86.99922f, -87.00629f, -87.01364f, -87.02125f,
+   -87.02913f, -87.03727f, -87.04568f, -87.05434f, -87.06327f, -87.07246f,
+   -87.08193f, -87.09166f, -87.10168f},
+  {-87.60604f, -87.48543f, -87.38657f, -87.30541f, -87.23843f, -87.18278f,
+   -87.13623f, -87.09705f, -87.0639f, -87.03573f, -87.01172f, -86.99122f,
+   -86.97369f, -86.95872f, -86.94596f, -86.93513f, -86.92599f, -86.91834f,
+   -86.91202f, -86.90689f, -86.90283f, -86.89972f, -86.89749f, -86.89605f,
+   -86.89534f, -86.8953f, -86.89588f, -86.89703f, -86.89871f, -86.90088f,
+   -86.90352f, -86.90659f, -86.91008f, -86.91395f, -86.91819f, -86.92279f,
+   -86.92771f, -86.93296f, -86.93852f, -86.94438f, -86.95053f, -86.95695f,
+   -86.96365f, -86.97062f, -86.97784f, -86.98533f, -86.99307f, -87.00106f,
+   -87.0093f, -87.01778f, -87.02652f, -87.03551f, -87.04475f, -87.05425f,
+   -87.064f, -87.07401f, -87.0843f},
+  {-87.49785f, -87.37672f, -87.28136f, -87.20548f, -87.14437f, -87.09456f,
+   -87.05355f, -87.01949f, -86.99102f, -86.9671f, -86.94694f, -86.92992f,
+   -86.91556f, -86.90348f, -86.89335f, -86.88492f, -86.87799f, -86.87237f,
+   -86.86792f, -86.86452f, -86.86205f, -86.86043f, -86.85959f, -86.85944f,
+   -86.85994f, -86.86104f, -86.86267f, -86.86482f, -86.86744f, -86.87051f,
+   -86.87398f, -86.87785f, -86.88209f, -86.88668f, -86.8916f, -86.89683f,
+   -86.90238f, -86.90821f, -86.91433f, -86.92072f, -86.92738f, -86.93429f,
+   -86.94146f, -86.94887f, -86.95653f, -86.96442f, -86.97256f, -86.98093f,
+   -86.98954f, -86.99838f, -87.00746f, -87.01677f, -87.02633f, -87.03613f,
+   -87.04617f, -87.05647f, -87.06703f},
+  {-87.35797f, -87.24398f, -87.15824f, -87.09219f, -87.04022f, -86.99862f,
+   -86.96488f, -86.93722f, -86.91438f, -86.89544f, -86.87969f, -86.86661f,
+   -86.85577f, -86.84684f, -86.83957f, -86.83374f, -86.82916f, -86.8257f,
+   -86.82322f, -86.82164f, -86.82085f, -86.82078f, -86.82138f, -86.82257f,
+   -86.82432f, -86.82659f, -86.82932f, -86.83249f, -86.83608f, -86.84005f,
+   -86.84439f, -86.84907f, -86.85407f, -86.85939f, -86.865f, -86.87089f,
+   -86.87706f, -86.88349f, -86.89018f, -86.89711f, -86.90428f, -86.91169f,
+   -86.91933f, -86.9272f, -86.93529f, -86.9436f, -86.95214f, -86.9609f,
+   -86.96987f, -86.97907f, -86.98849f, -86.99814f, -87.00801f, -87.01812f,
+   -87.02846f, -87.03905f, -87.04988f},
+  {-87.1796f, -87.08524f, -87.01726f, -86.96631f, -86.92697f, -86.89594f,
+   -86.8711f, -86.85101f, -86.83466f, -86.82133f, -86.81047f, -86.80169f,
+   -86.79466f, -86.78913f, -86.7849f, -86.7818f, -86.77971f, -86.7785f,
+   -86.77809f, -86.77839f, -86.77934f, -86.78088f, -86.78296f, -86.78554f,
+   -86.78857f, -86.79203f, -86.79588f, -86.80011f, -86.80468f, -86.80958f,
+   -86.81479f, -86.82029f, -86.82608f, -86.83213f, -86.83844f, -86.845f,
+   -86.8518f, -86.85883f, -86.86609f, -86.87357f, -86.88126f, -86.88917f,
+   -86.89729f, -86.90561f, -86.91414f, -86.92288f, -86.93182f, -86.94096f,
+   -86.95031f, -86.95987f, -86.96964f, -86.97962f, -86.98981f, -87.00023f,
+   -87.01087f, -87.02174f, -87.03286f},
+  {-86.96185f, -86.90285f, -86.86122f, -86.83034f, -86.80667f, -86.78817f,
+   -86.77355f, -86.76193f, -86.75271f, -86.74547f, -86.73987f, -86.73567f,
+   -86.73266f, -86.73069f, -86.72963f, -86.72939f, -86.72986f, -86.73099f,
+   -86.73269f, -86.73494f, -86.73767f, -86.74085f, -86.74445f, -86.74843f,
+   -86.75277f, -86.75744f, -86.76243f, -86.76772f, -86.77329f, -86.77913f,
+   -86.78522f, -86.79156f, -86.79813f, -86.80493f, -86.81195f, -86.81918f,
+   -86.82662f, -86.83426f, -86.84209f, -86.85012f, -86.85834f, -86.86675f,
+   -86.87535f, -86.88414f, -86.89311f, -86.90227f, -86.91162f, -86.92115f,
+   -86.93088f, -86.94079f, -86.95091f, -86.96122f, -86.97174f, -86.98247f,
+   -86.99341f, -87.00458f, -87.01597f},
+  {-86.71717f, -86.7057f, -86.69627f, -86.68859f, -86.68243f, -86.6776f,
+   -86.67394f, -86.67131f, -86.6696f, -86.66871f, -86.66856f, -86.66909f,
+   -86.67022f, -86.67191f, -86.6741f, -86.67676f, -86.67986f, -86.68335f,
+   -86.68722f, -86.69143f, -86.69597f, -86.70081f, -86.70594f, -86.71134f,
+   -86.717f, -86.72291f, -86.72904f, -86.73541f, -86.74198f, -86.74877f,
+   -86.75575f, -86.76293f, -86.77029f, -86.77784f, -86.78557f, -86.79347f,
+   -86.80155f, -86.8098f, -86.81821f, -86.8268f, -86.83555f, -86.84446f,
+   -86.85354f, -86.86279f, -86.87221f, -86.88179f, -86.89154f, -86.90147f,
+   -86.91157f, -86.92185f, -86.93232f, -86.94297f, -86.95381f, -86.96485f,
+   -86.9761f, -86.98755f, -86.99923f}
+};
+
+static const float kin_y_lu[KIN_LU_Z_SIZE][KIN_LU_A_SIZE] = {
+  {-88.36677f, -88.35327f, -88.33997f, -88.32688f, -88.31399f, -88.30133f,
+   -88.2889f, -88.27671f, -88.26477f, -88.25308f, -88.24165f, -88.2305f,
+   -88.21962f, -88.20903f, -88.19873f, -88.18873f, -88.17903f, -88.16964f,
+   -88.16056f, -88.15181f, -88.14338f, -88.13528f, -88.12752f, -88.12009f,
+   -88.11301f, -88.10628f, -88.09991f, -88.09389f, -88.08823f, -88.08294f,
+   -88.07802f, -88.07347f, -88.0693f, -88.06552f, -88.06213f, -88.05913f,
+   -88.05653f, -88.05434f, -88.05257f, -88.05121f, -88.05029f, -88.04981f,
+   -88.04978f, -88.05021f, -88.05112f, -88.05252f, -88.05443f, -88.05687f,
+   -88.05987f, -88.06345f, -88.06764f, -88.07248f, -88.07801f, -88.08429f,
+   -88.09138f, -88.09936f, -88.10833f},
+  {-88.3569f, -88.34312f, -88.32953f, -88.31616f, -88.303f, -88.29006f,
+   -88.27736f, -88.26491f, -88.2527f, -88.24076f, -88.22908f, -88.21768f,
+   -88.20656f, -88.19573f, -88.1852f, -88.17497f, -88.16505f, -88.15544f,
+   -88.14616f, -88.1372f, -88.12857f, -88.12028f, -88.11233f, -88.10473f,
+   -88.09747f, -88.09057f, -88.08402f, -88.07784f, -88.07202f, -88.06657f,
+   -88.0615f, -88.0568f, -88.05249f, -88.04856f, -88.04502f, -88.04188f,
+   -88.03914f, -88.03681f, -88.03489f, -88.03339f, -88.03232f, -88.03169f,
+   -88.0315f, -88.03177f, -88.03251f, -88.03374f, -88.03547f, -88.03771f,
+   -88.0405f, -88.04384f, -88.04779f, -88.05235f, -88.05758f, -88.06353f,
+   -88.07024f, -88.07779f, -88.08625f},
+  {-88.34715f, -88.33308f, -88.3192f, -88.30554f, -88.29209f, -88.27888f,
+   -88.2659f, -88.25317f, -88.2407f, -88.22849f, -88.21655f, -88.2049f,
+   -88.19353f, -88.18246f, -88.17169f, -88.16123f, -88.15108f, -88.14126f,
+   -88.13177f, -88.1226f, -88.11377f, -88.10529f, -88.09715f, -88.08936f,
+   -88.08193f, -88.07486f, -88.06814f, -88.0618f, -88.05582f, -88.05022f,
+   -88.045f, -88.04016f, -88.0357f, -88.03163f, -88.02795f, -88.02467f,
+   -88.0218f, -88.01933f, -88.01727f, -88.01564f, -88.01443f, -88.01365f,
+   -88.01332f, -88.01345f, -88.01403f, -88.0151f, -88.01665f, -88.01872f,
+   -88.02131f, -88.02445f, -88.02817f, -88.03249f, -88.03745f, -88.04309f,
+   -88.04946f, -88.05663f, -88.06465f},
+  {-88.33753f, -88.32315f, -88.30898f, -88.29501f, -88.28127f, -88.26777f,
+   -88.2545f, -88.24149f, -88.22874f, -88.21626f, -88.20406f, -88.19214f,
+   -88.18052f, -88.16921f, -88.1582f, -88.1475f, -88.13713f, -88.12709f,
+   -88.11737f, -88.108f, -88.09897f, -88.09029f, -88.08197f, -88.074f,
+   -88.06639f, -88.05914f, -88.05226f, -88.04576f, -88.03963f, -88.03388f,
+   -88.0285f, -88.02352f, -88.01892f, -88.01472f, -88.01091f, -88.00749f,
+   -88.00449f, -88.00189f, -87.99971f, -87.99794f, -87.9966f, -87.99569f,
+   -87.99523f, -87.99521f, -87.99566f, -87.99657f, -87.99797f, -87.99987f,
+   -88.00229f, -88.00524f, -88.00875f, -88.01285f, -88.01756f, -88.02294f,
+   -88.02901f, -88.03583f, -88.04347f},
+  {-88.32802f, -88.31333f, -88.29885f, -88.28458f, -88.27053f, -88.25673f,
+   -88.24317f, -88.22987f, -88.21683f, -88.20407f, -88.1916f, -88.17942f,
+   -88.16754f, -88.15596f, -88.14471f, -88.13378f, -88.12317f, -88.1129f,
+   -88.10297f, -88.09339f, -88.08416f, -88.07528f, -88.06677f, -88.05861f,
+   -88.05083f, -88.04341f, -88.03637f, -88.0297f, -88.02342f, -88.01752f,
+   -88.012f, -88.00688f, -88.00215f, -87.99781f, -87.99387f, -87.99033f,
+   -87.9872f, -87.98448f, -87.98217f, -87.98029f, -87.97882f, -87.97779f,
+   -87.9772f, -87.97706f, -87.97737f, -87.97815f, -87.9794f, -87.98115f,
+   -87.98341f, -87.98619f, -87.98951f, -87.99341f, -87.99791f, -88.00304f,
+   -88.00884f, -88.01536f, -88.02265f},
+  {-88.31864f, -88.30362f, -88.28882f, -88.27423f, -88.25987f, -88.24575f,
+   -88.23189f, -88.21829f, -88.20496f, -88.19191f, -88.17916f, -88.1667f,
+   -88.15456f, -88.14273f, -88.13122f, -88.12004f, -88.1092f, -88.0987f,
+   -88.08855f, -88.07876f, -88.06932f, -88.06024f, -88.05154f, -88.0432f,
+   -88.03524f, -88.02765f, -88.02045f, -88.01362f, -88.00719f, -88.00114f,
+   -87.99549f, -87.99022f, -87.98536f, -87.98089f, -87.97683f, -87.97317f,
+   -87.96992f, -87.96709f, -87.96466f, -87.96266f, -87.96109f, -87.95994f,
+   -87.95923f, -87.95897f, -87.95916f, -87.95981f, -87.96093f, -87.96254f,
+   -87.96465f, -87.96728f, -87.97044f, -87.97415f, -87.97845f, -87.98336f,
+   -87.98892f, -87.99517f, -88.00216f},
+  {-88.30937f, -88.29402f, -88.27888f, -88.26396f, -88.24928f, -88.23484f,
+   -88.22066f, -88.20675f, -88.19312f, -88.17978f, -88.16673f, -88.154f,
+   -88.14158f, -88.12948f, -88.11771f, -88.10629f, -88.09521f, -88.08448f,
+   -88.0741f, -88.06409f, -88.05444f, -88.04517f, -88.03627f, -88.02775f,
+   -88.01961f, -88.01185f, -88.00449f, -87.99751f, -87.99092f, -87.98473f,
+   -87.97894f, -87.97355f, -87.96855f, -87.96396f, -87.95978f, -87.95601f,
+   -87.95264f, -87.9497f, -87.94716f, -87.94506f, -87.94337f, -87.94212f,
+   -87.9413f, -87.94093f, -87.94101f, -87.94154f, -87.94255f, -87.94403f,
+   -87.94601f, -87.94849f, -87.9515f, -87.95505f, -87.95917f, -87.96389f,
+   -87.96923f, -87.97523f, -87.98195f},
+  {-88.30022f, -88.28452f, -88.26903f, -88.25377f, -88.23875f, -88.22398f,
+   -88.20947f, -88.19524f, -88.1813f, -88.16765f, -88.15431f, -88.14129f,
+   -88.12858f, -88.11622f, -88.10419f, -88.09251f, -88.08118f, -88.07021f,
+   -88.05961f, -88.04938f, -88.03952f, -88.03005f, -88.02095f, -88.01225f,
+   -88.00393f, -87.99601f, -87.98848f, -87.98134f, -87.97461f, -87.96828f,
+   -87.96235f, -87.95683f, -87.95171f, -87.947f, -87.94271f, -87.93882f,
+   -87.93535f, -87.9323f, -87.92966f, -87.92745f, -87.92567f, -87.92432f,
+   -87.9234f, -87.92293f, -87.9229f, -87.92333f, -87.92423f, -87.9256f,
+   -87.92745f, -87.92981f, -87.93268f, -87.93609f, -87.94005f, -87.94458f,
+   -87.94973f, -87.95552f, -87.962f},
+  {-88.29118f, -88.27511f, -88.25927f, -88.24365f, -88.22828f, -88.21317f,
+   -88.19832f, -88.18376f, -88.1695f, -88.15553f, -88.14189f, -88.12856f,
+   -88.11557f, -88.10292f, -88.09063f, -88.07868f, -88.06711f, -88.0559f,
+   -88.04506f, -88.03461f, -88.02454f, -88.01486f, -88.00557f, -87.99668f,
+   -87.98819f, -87.9801f, -87.97241f, -87.96512f, -87.95824f, -87.95178f,
+   -87.94572f, -87.94007f, -87.93483f, -87.93001f, -87.9256f, -87.92161f,
+   -87.91803f, -87.91488f, -87.91215f, -87.90985f, -87.90797f, -87.90653f,
+   -87.90552f, -87.90495f, -87.90484f, -87.90517f, -87.90597f, -87.90723f,
+   -87.90898f, -87.91122f, -87.91397f, -87.91724f, -87.92106f, -87.92544f,
+   -87.93041f, -87.93601f, -87.94227f},
+  {-88.28225f, -88.26581f, -88.24959f, -88.2336f, -88.21787f, -88.2024f,
+   -88.1872f, -88.1723f, -88.1577f, -88.14341f, -88.12945f, -88.11582f,
+   -88.10253f, -88.0896f, -88.07702f, -88.06481f, -88.05298f, -88.04152f,
+   -88.03046f, -88.01978f, -88.00949f, -87.99961f, -87.99012f, -87.98105f,
+   -87.97238f, -87.96412f, -87.95627f, -87.94883f, -87.94181f, -87.9352f,
+   -87.92902f, -87.92324f, -87.91789f, -87.91296f, -87.90844f, -87.90435f,
+   -87.90068f, -87.89744f, -87.89462f, -87.89223f, -87.89026f, -87.88874f,
+   -87.88765f, -87.88699f, -87.88679f, -87.88704f, -87.88775f, -87.88892f,
+   -87.89057f, -87.89271f, -87.89535f, -87.8985f, -87.90219f, -87.90643f,
+   -87.91125f, -87.91668f, -87.92274f},
+  {-88.27343f, -88.2566f, -88.23999f, -88.22362f, -88.2075f, -88.19166f,
+   -88.17611f, -88.16085f, -88.14591f, -88.13128f, -88.11699f, -88.10304f,
+   -88.08945f, -88.07622f, -88.06336f, -88.05088f, -88.03878f, -88.02708f,
+   -88.01577f, -88.00486f, -87.99436f, -87.98427f, -87.97459f, -87.96533f,
+   -87.95648f, -87.94805f, -87.94004f, -87.93246f, -87.9253f, -87.91856f,
+   -87.91224f, -87.90635f, -87.90089f, -87.89585f, -87.89123f, -87.88705f,
+   -87.88329f, -87.87995f, -87.87705f, -87.87458f, -87.87254f, -87.87093f,
+   -87.86976f, -87.86904f, -87.86876f, -87.86893f, -87.86956f, -87.87065f,
+   -87.87221f, -87.87426f, -87.8768f, -87.87985f, -87.88343f, -87.88754f,
+   -87.89222f, -87.8975f, -87.90339f},
+  {-88.26473f, -88.24748f, -88.23046f, -88.21369f, -88.19719f, -88.18096f,
+   -88.16503f, -88.14941f, -88.1341f, -88.11913f, -88.1045f, -88.09023f,
+   -88.07632f, -88.06279f, -88.04964f, -88.03688f, -88.02451f, -88.01255f,
+   -88.001f, -87.98986f, -87.97914f, -87.96884f, -87.95896f, -87.94951f,
+   -87.94048f, -87.93189f, -87.92372f, -87.91599f, -87.90869f, -87.90182f,
+   -87.89538f, -87.88938f, -87.88381f, -87.87867f, -87.87396f, -87.86968f,
+   -87.86583f, -87.86242f, -87.85944f, -87.85689f, -87.85478f, -87.85311f,
+   -87.85187f, -87.85108f, -87.85073f, -87.85083f, -87.85139f, -87.85241f,
+   -87.8539f, -87.85586f, -87.85832f, -87.86128f, -87.86475f, -87.86876f,
+   -87.87332f, -87.87846f, -87.8842f},
+  {-88.25613f, -88.23845f, -88.22101f, -88.20382f, -88.18691f, -88.17028f,
+   -88.15396f, -88.13795f, -88.12228f, -88.10695f, -88.09197f, -88.07736f,
+   -88.06313f, -88.04928f, -88.03583f, -88.02279f, -88.01015f, -87.99793f,
+   -87.98613f, -87.97475f, -87.96381f, -87.9533f, -87.94322f, -87.93358f,
+   -87.92438f, -87.91562f, -87.9073f, -87.89942f, -87.89198f, -87.88499f,
+   -87.87843f, -87.87232f, -87.86664f, -87.8614f, -87.8566f, -87.85224f,
+   -87.84831f, -87.84483f, -87.84177f, -87.83916f, -87.83698f, -87.83525f,
+   -87.83395f, -87.8331f, -87.83269f, -87.83273f, -87.83323f, -87.83419f,
+   -87.83561f, -87.83751f, -87.83989f, -87.84277f, -87.84616f, -87.85007f,
+   -87.85452f, -87.85954f, -87.86515f},
+  {-88.24763f, -88.22951f, -88.21163f, -88.19401f, -88.17667f, -88.15962f,
+   -88.14289f, -88.12649f, -88.11043f, -88.09472f, -88.07939f, -88.06443f,
+   -88.04986f, -88.0357f, -88.02194f, -88.0086f, -87.99568f, -87.98319f,
+   -87.97114f, -87.95953f, -87.94836f, -87.93763f, -87.92736f, -87.91753f,
+   -87.90815f, -87.89923f, -87.89075f, -87.88273f, -87.87516f, -87.86804f,
+   -87.86137f, -87.85515f, -87.84937f, -87.84404f, -87.83916f, -87.83472f,
+   -87.83072f, -87.82716f, -87.82405f, -87.82137f, -87.81914f, -87.81735f,
+   -87.816f, -87.8151f, -87.81464f, -87.81463f, -87.81507f, -87.81598f,
+   -87.81735f, -87.81919f, -87.8215f, -87.82431f, -87.82763f, -87.83145f,
+   -87.83582f, -87.84073f, -87.84622f},
+  {-88.23925f, -88.22065f, -88.20231f, -88.18424f, -88.16645f, -88.14897f,
+   -88.13182f, -88.115f, -88.09854f, -88.08245f, -88.06674f, -88.05142f,
+   -88.03651f, -88.02201f, -88.00794f, -87.9943f, -87.9811f, -87.96834f,
+   -87.95603f, -87.94417f, -87.93277f, -87.92184f, -87.91136f, -87.90134f,
+   -87.89179f, -87.8827f, -87.87408f, -87.86592f, -87.85822f, -87.85097f,
+   -87.84419f, -87.83787f, -87.832f, -87.82658f, -87.82162f, -87.8171f,
+   -87.81304f, -87.80942f, -87.80625f, -87.80352f, -87.80124f, -87.7994f,
+   -87.798f, -87.79706f, -87.79656f, -87.79651f, -87.79691f, -87.79777f,
+   -87.79909f, -87.80088f, -87.80315f, -87.8059f, -87.80915f, -87.81291f,
+   -87.81719f, -87.82202f, -87.82741f},
+  {-88.23096f, -88.21188f, -88.19305f, -88.17451f, -88.15626f, -88.13832f,
+   -88.12073f, -88.10348f, -88.0866f, -88.07011f, -88.05401f, -88.03833f,
+   -88.02306f, -88.00822f, -87.99382f, -87.97987f, -87.96638f, -87.95334f,
+   -87.94077f, -87.92867f, -87.91704f, -87.90589f, -87.89521f, -87.88501f,
+   -87.87528f, -87.86603f, -87.85726f, -87.84896f, -87.84113f, -87.83377f,
+   -87.82688f, -87.82046f, -87.8145f, -87.80901f, -87.80397f, -87.79939f,
+   -87.79526f, -87.79159f, -87.78837f, -87.78559f, -87.78327f, -87.78139f,
+   -87.77996f, -87.77898f, -87.77844f, -87.77836f, -87.77873f, -87.77955f,
+   -87.78084f, -87.78259f, -87.78482f, -87.78752f, -87.79072f, -87.79442f,
+   -87.79864f, -87.80339f, -87.80869f},
+  {-88.22278f, -88.20318f, -88.18385f, -88.16481f, -88.14607f, -88.12767f,
+   -88.10961f, -88.09192f, -88.07461f, -88.0577f, -88.0412f, -88.02513f,
+   -88.00949f, -87.9943f, -87.97957f, -87.96531f, -87.95151f, -87.9382f,
+   -87.92536f, -87.91301f, -87.90115f, -87.88978f, -87.8789f, -87.86851f,
+   -87.85861f, -87.8492f, -87.84028f, -87.83184f, -87.82389f, -87.81642f,
+   -87.80943f, -87.80292f, -87.79688f, -87.79131f, -87.7862f, -87.78156f,
+   -87.77738f, -87.77366f, -87.77039f, -87.76758f, -87.76522f, -87.76331f,
+   -87.76185f, -87.76084f, -87.76028f, -87.76017f, -87.76052f, -87.76132f,
+   -87.76258f, -87.7643f, -87.7665f, -87.76917f, -87.77232f, -87.77598f,
+   -87.78014f, -87.78483f, -87.79006f},
+  {-88.2147f, -88.19457f, -88.17471f, -88.15514f, -88.1359f, -88.117f,
+   -88.09846f, -88.0803f, -88.06254f, -88.0452f, -88.02828f, -88.01181f,
+   -87.9958f, -87.98025f, -87.96518f, -87.95059f, -87.93649f, -87.92288f,
+   -87.90978f, -87.89718f, -87.88508f, -87.87349f, -87.86241f, -87.85183f,
+   -87.84176f, -87.83219f, -87.82313f, -87.81456f, -87.80649f, -87.79892f,
+   -87.79183f, -87.78523f, -87.77911f, -87.77347f, -87.7683f, -87.76361f,
+   -87.75938f, -87.75562f, -87.75232f, -87.74948f, -87.74709f, -87.74516f,
+   -87.74368f, -87.74265f, -87.74207f, -87.74195f, -87.74228f, -87.74306f,
+   -87.7443f, -87.74601f, -87.74818f, -87.75083f, -87.75395f, -87.75757f,
+   -87.7617f, -87.76634f, -87.77151f},
+  {-88.20672f, -88.18602f, -88.1656f, -88.14549f, -88.12572f, -88.1063f,
+   -88.08726f, -88.06861f, -88.05038f, -88.03259f, -88.01525f, -87.99836f,
+   -87.98196f, -87.96604f, -87.95061f, -87.93569f, -87.92128f, -87.90738f,
+   -87.894f, -87.88115f, -87.86882f, -87.85701f, -87.84572f, -87.83496f,
+   -87.82472f, -87.815f, -87.80579f, -87.7971f, -87.78892f, -87.78124f,
+   -87.77406f, -87.76738f, -87.76119f, -87.75549f, -87.75027f, -87.74553f,
+   -87.74126f, -87.73747f, -87.73414f, -87.73127f, -87.72887f, -87.72692f,
+   -87.72543f, -87.72439f, -87.72381f, -87.72367f, -87.724f, -87.72477f,
+   -87.72601f, -87.7277f, -87.72986f, -87.73249f, -87.7356f, -87.7392f,
+   -87.74329f, -87.74789f, -87.75302f},
+  {-88.19884f, -88.17755f, -88.15654f, -88.13586f, -88.11553f, -88.09556f,
+   -88.07599f, -88.05684f, -88.03813f, -88.01987f, -88.00207f, -87.98476f,
+   -87.96795f, -87.95165f, -87.93586f, -87.9206f, -87.90587f, -87.89168f,
+   -87.87802f, -87.86491f, -87.85234f, -87.84031f, -87.82883f, -87.81788f,
+   -87.80748f, -87.7976f, -87.78826f, -87.77945f, -87.77115f, -87.76338f,
+   -87.75611f, -87.74936f, -87.74311f, -87.73735f, -87.73208f, -87.7273f,
+   -87.72301f, -87.71919f, -87.71584f, -87.71296f, -87.71054f, -87.70859f,
+   -87.70709f, -87.70606f, -87.70547f, -87.70534f, -87.70567f, -87.70645f,
+   -87.70768f, -87.70938f, -87.71154f, -87.71416f, -87.71726f, -87.72084f,
+   -87.72492f, -87.7295f, -87.73459f},
+  {-88.19106f, -88.16914f, -88.14752f, -88.12623f, -88.10531f, -88.08478f,
+   -88.06466f, -88.04498f, -88.02575f, -88.007f, -87.98875f, -87.971f,
+   -87.95377f, -87.93707f, -87.92091f, -87.9053f, -87.89025f, -87.87575f,
+   -87.86182f, -87.84844f, -87.83563f, -87.82339f, -87.8117f, -87.80058f,
+   -87.79001f, -87.77999f, -87.77051f, -87.76158f, -87.75318f, -87.74532f,
+   -87.73798f, -87.73116f, -87.72485f, -87.71904f, -87.71374f, -87.70893f,
+   -87.70461f, -87.70077f, -87.69741f, -87.69453f, -87.69211f, -87.69016f,
+   -87.68867f, -87.68764f, -87.68707f, -87.68695f, -87.68729f, -87.68808f,
+   -87.68932f, -87.69103f, -87.69319f, -87.69582f, -87.69893f, -87.70251f,
+   -87.70657f, -87.71114f, -87.71621f},
+  {-88.18337f, -88.16078f, -88.13852f, -88.1166f, -88.09506f, -88.07393f,
+   -88.05324f, -88.033f, -88.01325f, -87.99399f, -87.97525f, -87.95704f,
+   -87.93938f, -87.92228f, -87.90574f, -87.88977f, -87.87439f, -87.85958f,
+   -87.84536f, -87.83173f, -87.81868f, -87.80622f, -87.79433f, -87.78303f,
+   -87.7723f, -87.76213f, -87.75253f, -87.74349f, -87.735f, -87.72705f,
+   -87.71964f, -87.71276f, -87.7064f, -87.70056f, -87.69522f, -87.69039f,
+   -87.68606f, -87.68221f, -87.67885f, -87.67597f, -87.67356f, -87.67162f,
+   -87.67015f, -87.66914f, -87.66858f, -87.66848f, -87.66884f, -87.66965f,
+   -87.67092f, -87.67265f, -87.67483f, -87.67748f, -87.68059f, -87.68418f,
+   -87.68825f, -87.69281f, -87.69787f},
+  {-88.17578f, -88.15249f, -88.12953f, -88.10695f, -88.08476f, -88.06301f,
+   -88.04171f, -88.02089f, -88.00058f, -87.9808f, -87.96156f, -87.94288f,
+   -87.92477f, -87.90725f, -87.89032f, -87.87399f, -87.85826f, -87.84315f,
+   -87.82864f, -87.81475f, -87.80146f, -87.78878f, -87.7767f, -87.76522f,
+   -87.75433f, -87.74403f, -87.73431f, -87.72516f, -87.71658f, -87.70856f,
+   -87.70108f, -87.69415f, -87.68775f, -87.68188f, -87.67653f, -87.67168f,
+   -87.66735f, -87.6635f, -87.66015f, -87.65728f, -87.65489f, -87.65297f,
+   -87.65152f, -87.65054f, -87.65001f, -87.64994f, -87.65033f, -87.65118f,
+   -87.65247f, -87.65423f, -87.65644f, -87.65911f, -87.66224f, -87.66585f,
+   -87.66993f, -87.6745f, -87.67957f},
+  {-88.16827f, -88.14424f, -88.12056f, -88.09727f, -88.0744f, -88.05199f,
+   -88.03006f, -88.00863f, -87.98774f, -87.96741f, -87.94765f, -87.92848f,
+   -87.90991f, -87.89196f, -87.87462f, -87.85792f, -87.84186f, -87.82642f,
+   -87.81163f, -87.79747f, -87.78395f, -87.77105f, -87.75878f, -87.74713f,
+   -87.73609f, -87.72566f, -87.71583f, -87.70658f, -87.69792f, -87.68983f,
+   -87.6823f, -87.67533f, -87.6689f, -87.66301f, -87.65764f, -87.6528f,
+   -87.64846f, -87.64463f, -87.6413f, -87.63845f, -87.63609f, -87.6342f,
+   -87.63279f, -87.63184f, -87.63135f, -87.63132f, -87.63175f, -87.63264f,
+   -87.63397f, -87.63577f, -87.63801f, -87.64072f, -87.64389f, -87.64752f,
+   -87.65163f, -87.65621f, -87.66129f},
+  {-88.16084f, -88.13603f, -88.11159f, -88.08756f, -88.06397f, -88.04086f,
+   -88.01826f, -87.9962f, -87.97471f, -87.9538f, -87.9335f, -87.91382f,
+   -87.89478f, -87.87638f, -87.85864f, -87.84156f, -87.82514f, -87.80939f,
+   -87.7943f, -87.77988f, -87.76612f, -87.75302f, -87.74056f, -87.72874f,
+   -87.71756f, -87.70701f, -87.69707f, -87.68773f, -87.679f, -87.67085f,
+   -87.66328f, -87.65627f, -87.64982f, -87.64392f, -87.63856f, -87.63372f,
+   -87.6294f, -87.62559f, -87.62229f, -87.61947f, -87.61715f, -87.6153f,
+   -87.61393f, -87.61303f, -87.61259f, -87.61261f, -87.61309f, -87.61403f,
+   -87.61542f, -87.61726f, -87.61955f, -87.6223f, -87.62551f, -87.62918f,
+   -87.63332f, -87.63794f, -87.64304f},
+  {-88.1535f, -88.12786f, -88.1026f, -88.07778f, -88.05344f, -88.0296f,
+   -88.0063f, -87.98357f, -87.96145f, -87.93994f, -87.91908f, -87.89887f,
+   -87.87934f, -87.86049f, -87.84232f, -87.82486f, -87.80809f, -87.79202f,
+   -87.77664f, -87.76196f, -87.74796f, -87.73465f, -87.72201f, -87.71004f,
+   -87.69872f, -87.68805f, -87.67801f, -87.6686f, -87.6598f, -87.65161f,
+   -87.644f, -87.63697f, -87.63052f, -87.62462f, -87.61926f, -87.61444f,
+   -87.61015f, -87.60638f, -87.60311f, -87.60034f, -87.59806f, -87.59627f,
+   -87.59496f, -87.59411f, -87.59373f, -87.59382f, -87.59436f, -87.59535f,
+   -87.5968f, -87.5987f, -87.60105f, -87.60386f, -87.60712f, -87.61084f,
+   -87.61502f, -87.61968f, -87.62481f},
+  {-88.14623f, -88.1197f, -88.09359f, -88.06794f, -88.04279f, -88.01818f,
+   -87.99415f, -87.97072f, -87.94793f, -87.92581f, -87.90436f, -87.88361f,
+   -87.86357f, -87.84425f, -87.82566f, -87.8078f, -87.79067f, -87.77428f,
+   -87.75861f, -87.74367f, -87.72945f, -87.71593f, -87.70312f, -87.69099f,
+   -87.67955f, -87.66877f, -87.65865f, -87.64917f, -87.64032f, -87.63208f,
+   -87.62446f, -87.61742f, -87.61097f, -87.60508f, -87.59975f, -87.59496f,
+   -87.59071f, -87.58698f, -87.58376f, -87.58105f, -87.57883f, -87.5771f,
+   -87.57585f, -87.57508f, -87.57477f, -87.57492f, -87.57553f, -87.5766f,
+   -87.57812f, -87.58009f, -87.5825f, -87.58537f, -87.5887f, -87.59247f,
+   -87.59671f, -87.60142f, -87.6066f},
+  {-88.13902f, -88.11156f, -88.08453f, -88.058f, -88.032f, -88.00658f,
+   -87.98177f, -87.95761f, -87.93413f, -87.91136f, -87.8893f, -87.86799f,
+   -87.84743f, -87.82763f, -87.80861f, -87.79035f, -87.77286f, -87.75614f,
+   -87.74019f, -87.72499f, -87.71054f, -87.69683f, -87.68385f, -87.67158f,
+   -87.66002f, -87.64915f, -87.63895f, -87.62941f, -87.62052f, -87.61227f,
+   -87.60463f, -87.5976f, -87.59116f, -87.5853f, -87.58f, -87.57526f,
+   -87.57106f, -87.56739f, -87.56423f, -87.56159f, -87.55944f, -87.55779f,
+   -87.55662f, -87.55592f, -87.55569f, -87.55593f, -87.55662f, -87.55777f,
+   -87.55937f, -87.56141f, -87.56391f, -87.56685f, -87.57025f, -87.57409f,
+   -87.5784f, -87.58316f, -87.58839f},
+  {-88.13187f, -88.10341f, -88.07541f, -88.04794f, -88.02105f, -87.99477f,
+   -87.96915f, -87.94422f, -87.92002f, -87.89656f, -87.87388f, -87.85199f,
+   -87.83089f, -87.8106f, -87.79113f, -87.77247f, -87.75462f, -87.73758f,
+   -87.72134f, -87.70589f, -87.69123f, -87.67733f, -87.66419f, -87.65179f,
+   -87.64012f, -87.62917f, -87.61891f, -87.60933f, -87.60041f, -87.59215f,
+   -87.58451f, -87.5775f, -87.57109f, -87.56527f, -87.56002f, -87.55534f,
+   -87.5512f, -87.5476f, -87.54452f, -87.54195f, -87.53989f, -87.53833f,
+   -87.53724f, -87.53664f, -87.5365f, -87.53683f, -87.53761f, -87.53885f,
+   -87.54054f, -87.54268f, -87.54526f, -87.54829f, -87.55177f, -87.55569f,
+   -87.56007f, -87.5649f, -87.5702f},
+  {-88.12477f, -88.09524f, -88.06621f, -88.03775f, -88.0099f, -87.98271f,
+   -87.95623f, -87.9305f, -87.90554f, -87.88138f, -87.85805f, -87.83555f,
+   -87.81391f, -87.79312f, -87.77319f, -87.75413f, -87.73592f, -87.71856f,
+   -87.70204f, -87.68635f, -87.67147f, -87.6574f, -87.64411f, -87.63159f,
+   -87.61983f, -87.60881f, -87.5985f, -87.58889f, -87.57996f, -87.5717f,
+   -87.56409f, -87.55711f, -87.55074f, -87.54498f, -87.53979f, -87.53518f,
+   -87.53112f, -87.5276f, -87.52461f, -87.52214f, -87.52018f, -87.51871f,
+   -87.51773f, -87.51722f, -87.51719f, -87.51762f, -87.51851f, -87.51985f,
+   -87.52165f, -87.52388f, -87.52656f, -87.52969f, -87.53325f, -87.53727f,
+   -87.54173f, -87.54664f, -87.55201f},
+  {-88.11771f, -88.08703f, -88.0569f, -88.02738f, -87.99852f, -87.97037f,
+   -87.94299f, -87.91641f, -87.89066f, -87.86577f, -87.84176f, -87.81864f,
+   -87.79644f, -87.77514f, -87.75476f, -87.73528f, -87.71671f, -87.69904f,
+   -87.68224f, -87.66632f, -87.65124f, -87.63701f, -87.62359f, -87.61097f,
+   -87.59912f, -87.58804f, -87.5777f, -87.56808f, -87.55916f, -87.55092f,
+   -87.54335f, -87.53642f, -87.53011f, -87.52441f, -87.51931f, -87.51478f,
+   -87.51081f, -87.50739f, -87.50451f, -87.50215f, -87.50029f, -87.49894f,
+   -87.49807f, -87.49768f, -87.49776f, -87.49831f, -87.49931f, -87.50077f,
+   -87.50267f, -87.50502f, -87.50781f, -87.51104f, -87.5147f, -87.51881f,
+   -87.52337f, -87.52837f, -87.53382f},
+  {-88.11066f, -88.07876f, -88.04745f, -88.0168f, -87.98687f, -87.95771f,
+   -87.92937f, -87.9019f, -87.87532f, -87.84967f, -87.82496f, -87.80122f,
+   -87.77843f, -87.75662f, -87.73578f, -87.7159f, -87.69697f, -87.67898f,
+   -87.66192f, -87.64577f, -87.63051f, -87.61613f, -87.60259f, -87.58988f,
+   -87.57798f, -87.56686f, -87.55651f, -87.54689f, -87.538f, -87.5298f,
+   -87.52227f, -87.51541f, -87.50918f, -87.50357f, -87.49856f, -87.49413f,
+   -87.49028f, -87.48697f, -87.4842f, -87.48196f, -87.48023f, -87.479f,
+   -87.47826f, -87.478f, -87.47821f, -87.47888f, -87.48002f, -87.4816f,
+   -87.48362f, -87.48609f, -87.489f, -87.49234f, -87.49612f, -87.50034f,
+   -87.50499f, -87.51009f, -87.51564f},
+  {-88.10361f, -88.0704f, -88.03783f, -88.00598f, -87.9749f, -87.94467f,
+   -87.91533f, -87.88692f, -87.85948f, -87.83304f, -87.80761f, -87.78321f,
+   -87.75984f, -87.73751f, -87.7162f, -87.69592f, -87.67664f, -87.65835f,
+   -87.64104f, -87.62468f, -87.60925f, -87.59473f, -87.58109f, -87.56832f,
+   -87.55637f, -87.54524f, -87.53489f, -87.5253f, -87.51645f, -87.50831f,
+   -87.50086f, -87.49408f, -87.48794f, -87.48244f, -87.47754f, -87.47323f,
+   -87.4695f, -87.46633f, -87.46369f, -87.46159f, -87.45999f, -87.4589f,
+   -87.4583f, -87.45818f, -87.45853f, -87.45935f, -87.46062f, -87.46233f,
+   -87.46449f, -87.46709f, -87.47013f, -87.4736f, -87.4775f, -87.48183f,
+   -87.4866f, -87.49181f, -87.49746f},
+  {-88.09653f, -88.06191f, -88.028f, -87.99486f, -87.96257f, -87.9312f,
+   -87.9008f, -87.87141f, -87.84308f, -87.81581f, -87.78964f, -87.76457f,
+   -87.74061f, -87.71775f, -87.69598f, -87.6753f, -87.65568f, -87.6371f,
+   -87.61955f, -87.603f, -87.58742f, -87.57279f, -87.55907f, -87.54625f,
+   -87.53428f, -87.52315f, -87.51283f, -87.50329f, -87.4945f, -87.48644f,
+   -87.47908f, -87.47241f, -87.46639f, -87.46101f, -87.45624f, -87.45207f,
+   -87.44848f, -87.44545f, -87.44297f, -87.44101f, -87.43957f, -87.43864f,
+   -87.43819f, -87.43823f, -87.43873f, -87.4397f, -87.44111f, -87.44298f,
+   -87.44528f, -87.44803f, -87.4512f, -87.4548f, -87.45884f, -87.4633f,
+   -87.46819f, -87.47352f, -87.47928f},
+  {-88.0894f, -88.05327f, -88.0179f, -87.98339f, -87.94981f, -87.91724f,
+   -87.88572f, -87.85531f, -87.82603f, -87.79792f, -87.77098f, -87.74523f,
+   -87.72067f, -87.69728f, -87.67506f, -87.65398f, -87.63404f, -87.61519f,
+   -87.59742f, -87.5807f, -87.56499f, -87.55027f, -87.53649f, -87.52365f,
+   -87.51169f, -87.50059f, -87.49032f, -87.48084f, -87.47214f, -87.46419f,
+   -87.45695f, -87.4504f, -87.44451f, -87.43928f, -87.43466f, -87.43065f,
+   -87.42722f, -87.42435f, -87.42203f, -87.42024f, -87.41897f, -87.41821f,
+   -87.41793f, -87.41813f, -87.4188f, -87.41993f, -87.42151f, -87.42353f,
+   -87.426f, -87.42889f, -87.43222f, -87.43597f, -87.44014f, -87.44474f,
+   -87.44977f, -87.45522f, -87.4611f},
+  {-88.08218f, -88.04441f, -88.00749f, -87.97151f, -87.93656f, -87.90271f,
+   -87.87001f, -87.83852f, -87.80827f, -87.77928f, -87.75156f, -87.72512f,
+   -87.69995f, -87.67604f, -87.65337f, -87.63193f, -87.61167f, -87.59257f,
+   -87.5746f, -87.55773f, -87.54192f, -87.52713f, -87.51333f, -87.50049f,
+   -87.48856f, -87.47752f, -87.46732f, -87.45795f, -87.44936f, -87.44153f,
+   -87.43443f, -87.42803f, -87.42231f, -87.41723f, -87.41279f, -87.40895f,
+   -87.4057f, -87.40302f, -87.40088f, -87.39928f, -87.39819f, -87.39761f,
+   -87.39751f, -87.39789f, -87.39874f, -87.40005f, -87.4018f, -87.404f,
+   -87.40663f, -87.40969f, -87.41317f, -87.41708f, -87.42141f, -87.42615f,
+   -87.43132f, -87.43691f, -87.44293f},
+  {-88.07482f, -88.03529f, -87.99669f, -87.95914f, -87.92273f, -87.88752f,
+   -87.85359f, -87.82097f, -87.78971f, -87.75982f, -87.7313f, -87.70416f,
+   -87.67839f, -87.65397f, -87.63087f, -87.60906f, -87.58851f, -87.56919f,
+   -87.55105f, -87.53406f, -87.51818f, -87.50336f, -87.48956f, -87.47675f,
+   -87.46488f, -87.45392f, -87.44384f, -87.43459f, -87.42614f, -87.41846f,
+   -87.41153f, -87.4053f, -87.39976f, -87.39488f, -87.39062f, -87.38698f,
+   -87.38393f, -87.38144f, -87.37951f, -87.37811f, -87.37722f, -87.37684f,
+   -87.37694f, -87.37752f, -87.37856f, -87.38006f, -87.382f, -87.38438f,
+   -87.38719f, -87.39042f, -87.39408f, -87.39815f, -87.40264f, -87.40754f,
+   -87.41286f, -87.4186f, -87.42475f},
+  {-88.06728f, -88.02584f, -87.98544f, -87.9462f, -87.90823f, -87.87159f,
+   -87.83635f, -87.80256f, -87.77025f, -87.73943f, -87.71011f, -87.68227f,
+   -87.6559f, -87.63098f, -87.60747f, -87.58532f, -87.56452f, -87.545f,
+   -87.52672f, -87.50965f, -87.49372f, -87.4789f, -87.46514f, -87.4524f,
+   -87.44063f, -87.42979f, -87.41984f, -87.41075f, -87.40247f, -87.39498f,
+   -87.38823f, -87.38221f, -87.37687f, -87.3722f, -87.36816f, -87.36474f,
+   -87.3619f, -87.35964f, -87.35792f, -87.35674f, -87.35607f, -87.3559f,
+   -87.35621f, -87.357f, -87.35825f, -87.35995f, -87.36209f, -87.36467f,
+   -87.36767f, -87.37109f, -87.37493f, -87.37918f, -87.38384f, -87.38891f,
+   -87.39438f, -87.40028f, -87.40658f},
+  {-88.05948f, -88.01597f, -87.97363f, -87.93258f, -87.89294f, -87.85479f,
+   -87.81818f, -87.78317f, -87.74978f, -87.71802f, -87.68789f, -87.65935f,
+   -87.6324f, -87.607f, -87.5831f, -87.56065f, -87.53962f, -87.51994f,
+   -87.50157f, -87.48444f, -87.46852f, -87.45374f, -87.44006f, -87.42742f,
+   -87.41578f, -87.4051f, -87.39532f, -87.38642f, -87.37834f, -87.37106f,
+   -87.36454f, -87.35874f, -87.35363f, -87.3492f, -87.3454f, -87.34221f,
+   -87.33962f, -87.33759f, -87.33612f, -87.33517f, -87.33473f, -87.33479f,
+   -87.33534f, -87.33635f, -87.33782f, -87.33974f, -87.34209f, -87.34487f,
+   -87.34808f, -87.35169f, -87.35572f, -87.36016f, -87.365f, -87.37025f,
+   -87.3759f, -87.38195f, -87.38841f},
+  {-88.05135f, -88.00559f, -87.96115f, -87.91817f, -87.87675f, -87.837f,
+   -87.79896f, -87.76268f, -87.72819f, -87.69547f, -87.66452f, -87.63531f,
+   -87.6078f, -87.58194f, -87.55769f, -87.53498f, -87.51376f, -87.49397f,
+   -87.47554f, -87.45841f, -87.44253f, -87.42784f, -87.41427f, -87.40178f,
+   -87.39032f, -87.37983f, -87.37026f, -87.36158f, -87.35374f, -87.3467f,
+   -87.34043f, -87.33489f, -87.33004f, -87.32587f, -87.32233f, -87.31941f,
+   -87.31708f, -87.31531f, -87.31409f, -87.3134f, -87.31322f, -87.31353f,
+   -87.31431f, -87.31557f, -87.31727f, -87.31942f, -87.32199f, -87.325f,
+   -87.32841f, -87.33224f, -87.33647f, -87.34111f, -87.34614f, -87.35157f,
+   -87.3574f, -87.36363f, -87.37026f},
+  {-88.04279f, -87.99459f, -87.94787f, -87.90281f, -87.85951f, -87.81806f,
+   -87.77853f, -87.74095f, -87.70532f, -87.67165f, -87.63989f, -87.61002f,
+   -87.58198f, -87.55571f, -87.53115f, -87.50823f, -87.48687f, -87.46702f,
+   -87.44859f, -87.43151f, -87.41573f, -87.40117f, -87.38777f, -87.37547f,
+   -87.36422f, -87.35397f, -87.34465f, -87.33623f, -87.32866f, -87.3219f,
+   -87.31591f, -87.31066f, -87.3061f, -87.30222f, -87.29897f, -87.29633f,
+   -87.29428f, -87.2928f, -87.29186f, -87.29144f, -87.29152f, -87.2921f,
+   -87.29314f, -87.29465f, -87.2966f, -87.29899f, -87.30181f, -87.30504f,
+   -87.30868f, -87.31273f, -87.31718f, -87.32202f, -87.32725f, -87.33288f,
+   -87.33889f, -87.3453f, -87.35211f},
+  {-88.03368f, -87.98281f, -87.93364f, -87.88634f, -87.84103f, -87.79781f,
+   -87.75672f, -87.7178f, -87.68103f, -87.64641f, -87.61387f, -87.58338f,
+   -87.55485f, -87.52822f, -87.50341f, -87.48033f, -87.4589f, -87.43904f,
+   -87.42066f, -87.4037f, -87.38806f, -87.37369f, -87.36051f, -87.34846f,
+   -87.33748f, -87.3275f, -87.31848f, -87.31036f, -87.3031f, -87.29666f,
+   -87.29098f, -87.28605f, -87.28181f, -87.27824f, -87.2753f, -87.27298f,
+   -87.27124f, -87.27006f, -87.26941f, -87.26929f, -87.26966f, -87.27051f,
+   -87.27183f, -87.27361f, -87.27583f, -87.27847f, -87.28154f, -87.28501f,
+   -87.28889f, -87.29317f, -87.29784f, -87.3029f, -87.30834f, -87.31417f,
+   -87.32038f, -87.32698f, -87.33397f},
+  {-88.02387f, -87.97009f, -87.91826f, -87.86856f, -87.82112f, -87.77603f,
+   -87.73334f, -87.69305f, -87.65515f, -87.61959f, -87.58631f, -87.55524f,
+   -87.52629f, -87.49936f, -87.47437f, -87.4512f, -87.42976f, -87.40997f,
+   -87.39172f, -87.37493f, -87.35951f, -87.34539f, -87.33249f, -87.32074f,
+   -87.31007f, -87.30042f, -87.29174f, -87.28397f, -87.27706f, -87.27096f,
+   -87.26564f, -87.26105f, -87.25716f, -87.25394f, -87.25134f, -87.24936f,
+   -87.24794f, -87.24709f, -87.24676f, -87.24695f, -87.24762f, -87.24878f,
+   -87.25039f, -87.25245f, -87.25494f, -87.25786f, -87.26118f, -87.26492f,
+   -87.26904f, -87.27356f, -87.27847f, -87.28375f, -87.28942f, -87.29546f,
+   -87.30188f, -87.30867f, -87.31585f},
+  {-88.01317f, -87.9562f, -87.90149f, -87.84922f, -87.79953f, -87.7525f,
+   -87.70816f, -87.6665f, -87.62748f, -87.59103f, -87.55706f, -87.52549f,
+   -87.49618f, -87.46904f, -87.44394f, -87.42077f, -87.39941f, -87.37976f,
+   -87.36172f, -87.34518f, -87.33005f, -87.31624f, -87.30368f, -87.29229f,
+   -87.28199f, -87.27272f, -87.26443f, -87.25704f, -87.25052f, -87.24482f,
+   -87.23989f, -87.23568f, -87.23217f, -87.22932f, -87.2271f, -87.22547f,
+   -87.22441f, -87.2239f, -87.22391f, -87.22443f, -87.22543f, -87.2269f,
+   -87.22882f, -87.23117f, -87.23396f, -87.23715f, -87.24076f, -87.24476f,
+   -87.24914f, -87.25391f, -87.25906f, -87.26458f, -87.27048f, -87.27674f,
+   -87.28337f, -87.29038f, -87.29776f},
+  {-88.00135f, -87.9409f, -87.88307f, -87.82805f, -87.77599f, -87.72694f,
+   -87.68093f, -87.6379f, -87.5978f, -87.56053f, -87.52595f, -87.49396f,
+   -87.4644f, -87.43714f, -87.41203f, -87.38896f, -87.36778f, -87.34837f,
+   -87.33061f, -87.3144f, -87.29964f, -87.28622f, -87.27407f, -87.2631f,
+   -87.25323f, -87.2444f, -87.23654f, -87.22959f, -87.22351f, -87.21823f,
+   -87.21373f, -87.20994f, -87.20684f, -87.20439f, -87.20256f, -87.20132f,
+   -87.20064f, -87.2005f, -87.20087f, -87.20174f, -87.20308f, -87.20488f,
+   -87.20712f, -87.20979f, -87.21288f, -87.21637f, -87.22026f, -87.22454f,
+   -87.2292f, -87.23423f, -87.23963f, -87.2454f, -87.25153f, -87.25802f,
+   -87.26488f, -87.2721f, -87.27969f},
+  {-87.98813f, -87.92385f, -87.86264f, -87.8047f, -87.75015f, -87.69904f,
+   -87.65135f, -87.60701f, -87.5659f, -87.52788f, -87.49281f, -87.46051f,
+   -87.43081f, -87.40355f, -87.37857f, -87.3557f, -87.3348f, -87.31573f,
+   -87.29837f, -87.28258f, -87.26827f, -87.25532f, -87.24365f, -87.23316f,
+   -87.22379f, -87.21545f, -87.20808f, -87.20162f, -87.19601f, -87.19121f,
+   -87.18717f, -87.18383f, -87.18118f, -87.17916f, -87.17776f, -87.17693f,
+   -87.17665f, -87.1769f, -87.17765f, -87.17888f, -87.18058f, -87.18273f,
+   -87.18531f, -87.18831f, -87.19172f, -87.19552f, -87.19971f, -87.20428f,
+   -87.20921f, -87.21452f, -87.22018f, -87.22621f, -87.23258f, -87.23932f,
+   -87.2464f, -87.25385f, -87.26165f},
+  {-87.97313f, -87.90466f, -87.83979f, -87.77875f, -87.72162f, -87.66843f,
+   -87.6191f, -87.57351f, -87.5315f, -87.49288f, -87.45744f, -87.42498f,
+   -87.39529f, -87.36818f, -87.34345f, -87.32092f, -87.30043f, -87.28182f,
+   -87.26495f, -87.24969f, -87.23591f, -87.22352f, -87.21241f, -87.20248f,
+   -87.19366f, -87.18588f, -87.17905f, -87.17313f, -87.16805f, -87.16376f,
+   -87.16022f, -87.15737f, -87.1552f, -87.15365f, -87.15269f, -87.1523f,
+   -87.15244f, -87.1531f, -87.15426f, -87.15588f, -87.15796f, -87.16047f,
+   -87.1634f, -87.16674f, -87.17048f, -87.1746f, -87.1791f, -87.18397f,
+   -87.1892f, -87.19479f, -87.20072f, -87.20701f, -87.21364f, -87.22062f,
+   -87.22795f, -87.23562f, -87.24364f},
+  {-87.9559f, -87.88282f, -87.81402f, -87.74971f, -87.68994f, -87.63468f,
+   -87.5838f, -87.53709f, -87.49433f, -87.45527f, -87.41966f, -87.38722f,
+   -87.35772f, -87.33092f, -87.30661f, -87.28457f, -87.26462f, -87.2466f,
+   -87.23034f, -87.21571f, -87.20258f, -87.19082f, -87.18035f, -87.17106f,
+   -87.16287f, -87.15569f, -87.14947f, -87.14413f, -87.13962f, -87.13589f,
+   -87.13289f, -87.13058f, -87.12891f, -87.12785f, -87.12737f, -87.12744f,
+   -87.12804f, -87.12913f, -87.13071f, -87.13273f, -87.1352f, -87.1381f,
+   -87.1414f, -87.1451f, -87.14918f, -87.15363f, -87.15845f, -87.16363f,
+   -87.16917f, -87.17504f, -87.18126f, -87.18782f, -87.19472f, -87.20195f,
+   -87.20952f, -87.21743f, -87.22568f},
+  {-87.93584f, -87.85771f, -87.7847f, -87.71698f, -87.65457f, -87.59733f,
+   -87.54503f, -87.4974f, -87.45411f, -87.41484f, -87.37927f, -87.34708f,
+   -87.31797f, -87.29169f, -87.26797f, -87.24659f, -87.22734f, -87.21005f,
+   -87.19453f, -87.18064f, -87.16825f, -87.15724f, -87.14749f, -87.13891f,
+   -87.13141f, -87.12491f, -87.11935f, -87.11465f, -87.11076f, -87.10763f,
+   -87.10521f, -87.10345f, -87.10233f, -87.10179f, -87.10182f, -87.10238f,
+   -87.10345f, -87.105f, -87.10701f, -87.10946f, -87.11234f, -87.11563f,
+   -87.11931f, -87.12338f, -87.12782f, -87.13262f, -87.13777f, -87.14327f,
+   -87.14912f, -87.15529f, -87.1618f, -87.16864f, -87.17581f, -87.1833f,
+   -87.19113f, -87.19928f, -87.20777f},
+  {-87.91219f, -87.82852f, -87.75104f, -87.67986f, -87.61486f, -87.55581f,
+   -87.50234f, -87.45405f, -87.41052f, -87.37134f, -87.33609f, -87.30441f,
+   -87.27595f, -87.2504f, -87.22749f, -87.20695f, -87.18857f, -87.17215f,
+   -87.15751f, -87.14449f, -87.13295f, -87.12277f, -87.11384f, -87.10605f,
+   -87.09932f, -87.09356f, -87.08871f, -87.0847f, -87.08148f, -87.07899f,
+   -87.07719f, -87.07603f, -87.07547f, -87.07549f, -87.07605f, -87.07713f,
+   -87.07869f, -87.08071f, -87.08318f, -87.08608f, -87.08938f, -87.09308f,
+   -87.09716f, -87.10161f, -87.10642f, -87.11157f, -87.11707f, -87.1229f,
+   -87.12906f, -87.13555f, -87.14236f, -87.14949f, -87.15693f, -87.16469f,
+   -87.17277f, -87.18118f, -87.18991f},
+  {-87.88393f, -87.79425f, -87.7121f, -87.63747f, -87.57009f, -87.50951f,
+   -87.45522f, -87.40666f, -87.36327f, -87.32453f, -87.28995f, -87.25909f,
+   -87.23156f, -87.20701f, -87.18512f, -87.16564f, -87.14831f, -87.13292f,
+   -87.1193f, -87.10728f, -87.0967f, -87.08746f, -87.07942f, -87.0725f,
+   -87.06661f, -87.06166f, -87.05758f, -87.05431f, -87.0518f, -87.05f,
+   -87.04885f, -87.04832f, -87.04837f, -87.04897f, -87.05009f, -87.0517f,
+   -87.05377f, -87.0563f, -87.05924f, -87.0626f, -87.06634f, -87.07047f,
+   -87.07495f, -87.0798f, -87.08498f, -87.09051f, -87.09636f, -87.10253f,
+   -87.10902f, -87.11582f, -87.12294f, -87.13036f, -87.13809f, -87.14613f,
+   -87.15447f, -87.16313f, -87.17211f},
+  {-87.84972f, -87.75358f, -87.66669f, -87.58881f, -87.5194f, -87.45777f,
+   -87.40317f, -87.35484f, -87.31207f, -87.27422f, -87.24071f, -87.21103f,
+   -87.18475f, -87.16147f, -87.14087f, -87.12265f, -87.10656f, -87.09239f,
+   -87.07993f, -87.06903f, -87.05953f, -87.05132f, -87.04428f, -87.03831f,
+   -87.03332f, -87.02924f, -87.02599f, -87.02352f, -87.02176f, -87.02068f,
+   -87.02023f, -87.02036f, -87.02105f, -87.02225f, -87.02395f, -87.02612f,
+   -87.02873f, -87.03177f, -87.03521f, -87.03903f, -87.04324f, -87.0478f,
+   -87.05271f, -87.05796f, -87.06353f, -87.06943f, -87.07564f, -87.08217f,
+   -87.08899f, -87.09612f, -87.10355f, -87.11127f, -87.11929f, -87.12761f,
+   -87.13623f, -87.14515f, -87.15438f},
+  {-87.80778f, -87.70483f, -87.61334f, -87.53267f, -87.46187f, -87.39989f,
+   -87.34566f, -87.29822f, -87.25666f, -87.22023f, -87.18826f, -87.16018f,
+   -87.1355f, -87.11381f, -87.09475f, -87.07803f, -87.06338f, -87.05058f,
+   -87.03944f, -87.02979f, -87.02149f, -87.01442f, -87.00846f, -87.00351f,
+   -86.9995f, -86.99634f, -86.99398f, -86.99235f, -86.99139f, -86.99107f,
+   -86.99135f, -86.99217f, -86.99352f, -86.99536f, -86.99767f, -87.00042f,
+   -87.00358f, -87.00715f, -87.0111f, -87.01541f, -87.02008f, -87.02509f,
+   -87.03044f, -87.0361f, -87.04208f, -87.04836f, -87.05494f, -87.06182f,
+   -87.06899f, -87.07645f, -87.0842f, -87.09223f, -87.10055f, -87.10915f,
+   -87.11805f, -87.12724f, -87.13672f},
+  {-87.75563f, -87.64584f, -87.55029f, -87.46769f, -87.3965f, -87.33515f,
+   -87.28222f, -87.23649f, -87.19687f, -87.16248f, -87.13258f, -87.10654f,
+   -87.08384f, -87.06406f, -87.04682f, -87.03183f, -87.01882f, -87.00757f,
+   -86.9979f, -86.98964f, -86.98264f, -86.9768f, -86.972f, -86.96816f,
+   -86.96519f, -86.96302f, -86.96159f, -86.96084f, -86.96073f, -86.96121f,
+   -86.96224f, -86.96379f, -86.96583f, -86.96833f, -86.97126f, -86.97461f,
+   -86.97834f, -86.98246f, -86.98693f, -86.99175f, -86.9969f, -87.00237f,
+   -87.00816f, -87.01425f, -87.02063f, -87.02731f, -87.03427f, -87.04152f,
+   -87.04904f, -87.05683f, -87.0649f, -87.07325f, -87.08187f, -87.09077f,
+   -87.09995f, -87.10941f, -87.11915f},
+  {-87.68992f, -87.57384f, -87.47547f, -87.39242f, -87.3223f, -87.26293f,
+   -87.21248f, -87.16944f, -87.1326f, -87.10094f, -87.07368f, -87.05016f,
+   -87.02985f, -87.01231f, -86.99718f, -86.98415f, -86.97298f, -86.96346f,
+   -86.95539f, -86.94864f, -86.94306f, -86.93854f, -86.93499f, -86.93232f,
+   -86.93045f, -86.92932f, -86.92887f, -86.92905f, -86.92982f, -86.93113f,
+   -86.93295f, -86.93525f, -86.938f, -86.94118f, -86.94476f, -86.94872f,
+   -86.95305f, -86.95772f, -86.96273f, -86.96806f, -86.97371f, -86.97965f,
+   -86.98589f, -86.99241f, -86.99922f, -87.00629f, -87.01364f, -87.02125f,
+   -87.02913f, -87.03727f, -87.04568f, -87.05434f, -87.06327f, -87.07246f,
+   -87.08193f, -87.09166f, -87.10168f},
+  {-87.60604f, -87.48543f, -87.38657f, -87.30541f, -87.23843f, -87.18278f,
+   -87.13623f, -87.09705f, -87.0639f, -87.03573f, -87.01172f, -86.99122f,
+   -86.97369f, -86.95872f, -86.94596f, -86.93513f, -86.92599f, -86.91834f,
+   -86.91202f, -86.90689f, -86.90283f, -86.89972f, -86.89749f, -86.89605f,
+   -86.89534f, -86.8953f, -86.89588f, -86.89703f, -86.89871f, -86.90088f,
+   -86.90352f, -86.90659f, -86.91008f, -86.91395f, -86.91819f, -86.92279f,
+   -86.92771f, -86.93296f, -86.93852f, -86.94438f, -86.95053f, -86.95695f,
+   -86.96365f, -86.97062f, -86.97784f, -86.98533f, -86.99307f, -87.00106f,
+   -87.0093f, -87.01778f, -87.02652f, -87.03551f, -87.04475f, -87.05425f,
+   -87.064f, -87.07401f, -87.0843f},
+  {-87.49785f, -87.37672f, -87.28136f, -87.20548f, -87.14437f, -87.09456f,
+   -87.05355f, -87.01949f, -86.99102f, -86.9671f, -86.94694f, -86.92992f,
+   -86.91556f, -86.90348f, -86.89335f, -86.88492f, -86.87799f, -86.87237f,
+   -86.86792f, -86.86452f, -86.86205f, -86.86043f, -86.85959f, -86.85944f,
+   -86.85994f, -86.86104f, -86.86267f, -86.86482f, -86.86744f, -86.87051f,
+   -86.87398f, -86.87785f, -86.88209f, -86.88668f, -86.8916f, -86.89683f,
+   -86.90238f, -86.90821f, -86.91433f, -86.92072f, -86.92738f, -86.93429f,
+   -86.94146f, -86.94887f, -86.95653f, -86.96442f, -86.97256f, -86.98093f,
+   -86.98954f, -86.99838f, -87.00746f, -87.01677f, -87.02633f, -87.03613f,
+   -87.04617f, -87.05647f, -87.06703f},
+  {-87.35797f, -87.24398f, -87.15824f, -87.09219f, -87.04022f, -86.99862f,
+   -86.96488f, -86.93722f, -86.91438f, -86.89544f, -86.87969f, -86.86661f,
+   -86.85577f, -86.84684f, -86.83957f, -86.83374f, -86.82916f, -86.8257f,
+   -86.82322f, -86.82164f, -86.82085f, -86.82078f, -86.82138f, -86.82257f,
+   -86.82432f, -86.82659f, -86.82932f, -86.83249f, -86.83608f, -86.84005f,
+   -86.84439f, -86.84907f, -86.85407f, -86.85939f, -86.865f, -86.87089f,
+   -86.87706f, -86.88349f, -86.89018f, -86.89711f, -86.90428f, -86.91169f,
+   -86.91933f, -86.9272f, -86.93529f, -86.9436f, -86.95214f, -86.9609f,
+   -86.96987f, -86.97907f, -86.98849f, -86.99814f, -87.00801f, -87.01812f,
+   -87.02846f, -87.03905f, -87.04988f},
+  {-87.1796f, -87.08524f, -87.01726f, -86.96631f, -86.92697f, -86.89594f,
+   -86.8711f, -86.85101f, -86.83466f, -86.82133f, -86.81047f, -86.80169f,
+   -86.79466f, -86.78913f, -86.7849f, -86.7818f, -86.77971f, -86.7785f,
+   -86.77809f, -86.77839f, -86.77934f, -86.78088f, -86.78296f, -86.78554f,
+   -86.78857f, -86.79203f, -86.79588f, -86.80011f, -86.80468f, -86.80958f,
+   -86.81479f, -86.82029f, -86.82608f, -86.83213f, -86.83844f, -86.845f,
+   -86.8518f, -86.85883f, -86.86609f, -86.87357f, -86.88126f, -86.88917f,
+   -86.89729f, -86.90561f, -86.91414f, -86.92288f, -86.93182f, -86.94096f,
+   -86.95031f, -86.95987f, -86.96964f, -86.97962f, -86.98981f, -87.00023f,
+   -87.01087f, -87.02174f, -87.03286f},
+  {-86.96185f, -86.90285f, -86.86122f, -86.83034f, -86.80667f, -86.78817f,
+   -86.77355f, -86.76193f, -86.75271f, -86.74547f, -86.73987f, -86.73567f,
+   -86.73266f, -86.73069f, -86.72963f, -86.72939f, -86.72986f, -86.73099f,
+   -86.73269f, -86.73494f, -86.73767f, -86.74085f, -86.74445f, -86.74843f,
+   -86.75277f, -86.75744f, -86.76243f, -86.76772f, -86.77329f, -86.77913f,
+   -86.78522f, -86.79156f, -86.79813f, -86.80493f, -86.81195f, -86.81918f,
+   -86.82662f, -86.83426f, -86.84209f, -86.85012f, -86.85834f, -86.86675f,
+   -86.87535f, -86.88414f, -86.89311f, -86.90227f, -86.91162f, -86.92115f,
+   -86.93088f, -86.94079f, -86.95091f, -86.96122f, -86.97174f, -86.98247f,
+   -86.99341f, -87.00458f, -87.01597f},
+  {-86.71717f, -86.7057f, -86.69627f, -86.68859f, -86.68243f, -86.6776f,
+   -86.67394f, -86.67131f, -86.6696f, -86.66871f, -86.66856f, -86.66909f,
+   -86.67022f, -86.67191f, -86.6741f, -86.67676f, -86.67986f, -86.68335f,
+   -86.68722f, -86.69143f, -86.69597f, -86.70081f, -86.70594f, -86.71134f,
+   -86.717f, -86.72291f, -86.72904f, -86.73541f, -86.74198f, -86.74877f,
+   -86.75575f, -86.76293f, -86.77029f, -86.77784f, -86.78557f, -86.79347f,
+   -86.80155f, -86.8098f, -86.81821f, -86.8268f, -86.83555f, -86.84446f,
+   -86.85354f, -86.86279f, -86.87221f, -86.88179f, -86.89154f, -86.90147f,
+   -86.91157f, -86.92185f, -86.93232f, -86.94297f, -86.95381f, -86.96485f,
+   -86.9761f, -86.98755f, -86.99923f}
+};
+
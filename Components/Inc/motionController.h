@@ -9,13 +9,50 @@
   * Project: P3D_firmware
   * Description:
   * This module provides all algorithms for track planning and
-  * control.
+  * control. The moves are planned by a separate task, which looks ahead
+  * over the buffered moves to join them without stopping: every move is split
+  * into short segments, the kinematics is solved for each of them and the
+  * segments are fed to the motion queue of the step motor drivers.
+  * The arcs and the Bezier curves are split into chords on the fly, within
+  * the chordal tolerance.
+  * The bed mesh may be added to Z of the segments, see SetMotionMesh().
+  ****Resources being consumed****
+  * motionPlanner task
+  * EXTI9_5 IRQ (the PE5, PE6, PE7 end stops)
+  * EXTI4 IRQ (the PE4 Z-probe)
   */
 
 #ifndef _MOTION_CONTROLLER_H_
 #define _MOTION_CONTROLLER_H_
 
+#include "stdint.h"
+
 #include "error.h"
+#include "stepMotor.h"
+
+/**
+  * @brief Handle of a queued move
+  */
+typedef uint32_t MoveHandle;
+
+/**
+  * @brief Grid of the points to be probed
+  */
+typedef struct
+{
+  float X0, Y0;                   /**< First point, mm */
+
+  float dX, dY;                   /**< Distance between the points, mm */
+
+  uint32_t nX, nY;                /**< Number of the points along the axises */
+
+  float Z_start;                  /**< Height to travel between the points at, mm */
+
+  float Z_end;                    /**< Lowest height to descend to, mm, below Z_start */
+
+  float speed;                    /**< Speed of the descent, mm/s */
+
+} Motion_ProbeGridTypeDef;
 
 /**
   * @brief Init all motors
@@ -38,10 +75,31 @@ Error EnableAllMotors(void);
 Error DisableAllMotors(void);
 
 /**
-  * @brief Move to the referent point
+  * @brief Move to the referent point.
+  * Waits for the queued moves to be finished first. All axises approach
+  * their end stops at once, back off and approach them again slowly.
+  * Every axis stops at the step its end stop is hit at.
+  * Returns _OutOfRange if an end stop isn't reached.
   */
 Error GoToRefer(void);
 
+/**
+  * @brief Probe the grid of points with the Z-probe.
+  * Waits for the queued moves to be finished first. The tool descends from
+  * Z_start over every point until the probe is triggered, the steps of all
+  * axises are latched by the probe IRQ at the very edge, the point is
+  * found by all of them. The moves of the next point are queued while a
+  * point is probed, so the points are probed back to back, and the tool is
+  * left at Z_start over the last point. Z is filled with the heights of the
+  * points probed, Z[j*nX + i] is the point (X0 + i*dX, Y0 + j*dY), it may
+  * be passed to BedMeshSet(). The bed mesh isn't applied while probing.
+  * Returns _OutOfRange if the probe isn't triggered over a descent or is
+  * triggered over a travel, the motors are stopped then and the position
+  * is found by their angles.
+  * Mustn't be called while other tasks put moves to the move buffer.
+  */
+Error ProbeGrid(const Motion_ProbeGridTypeDef* grid, float* Z);
+
 /**
   * @brief Zero out all coordinates.
   * Call this function by the end-stop signal
@@ -49,8 +107,109 @@ Error GoToRefer(void);
 Error ZeroOutPosition(void);
 
 /**
-  * @brief Move to the specified point with the specified speed
+  * @brief Move to the specified point with the specified speed (mm/s).
+  * The tool moves along the straight line. Consecutive moves are joined
+  * without stopping: the corners are passed with the speed depending on
+  * their angle, the tool decelerates only where the corners or the end of
+  * the buffered moves require it.
+  * The move is put to the move buffer and the function returns as soon as
+  * there is room for it, so consecutive moves are executed back to back.
+  * The calling task sleeps while the buffer is full and is woken up by the
+  * planner when the oldest move is planned.
+  * Use WaitForMotionEnd() to wait until the point is reached.
   */
 Error GoToWithSpeed(double X, double Y, double Z, double speed);
 
+/**
+  * @brief Put the move to the specified point to the move buffer and
+  * return immediately. handle identifies the move for IsMoveDone() and
+  * WaitForMove(), it may be NULL.
+  * Returns _QueueFull if there is no room for the move and _OutOfRange
+  * if the point can't be reached.
+  */
+Error GoToWithSpeedAsync(double X, double Y, double Z, double speed, MoveHandle* handle);
+
+/**
+  * @brief Move along the arc in the XY plane to the specified point with the
+  * specified speed (mm/s), Z changes linearly along the arc (helix).
+  * I and J are the offsets of the arc center from the current point, the
+  * arc is passed clockwise or counterclockwise, the end point equal to the
+  * current one gives the full circle. The arc is split into chords by the
+  * planner, so the arc takes a single entry of the move buffer. The move is
+  * joined to the neighbour ones like the straight ones.
+  * Returns _OutOfRange if the end point isn't on the arc.
+  */
+Error GoToArcWithSpeed(double X, double Y, double Z, double I, double J,
+                       uint8_t clockwise, double speed);
+
+/**
+  * @brief The same as GoToArcWithSpeed(), but returns immediately like
+  * GoToWithSpeedAsync()
+  */
+Error GoToArcWithSpeedAsync(double X, double Y, double Z, double I, double J,
+                            uint8_t clockwise, double speed, MoveHandle* handle);
+
+/**
+  * @brief Move along the cubic Bezier curve to the specified point with the
+  * specified speed (mm/s). (X1, Y1, Z1) and (X2, Y2, Z2) are the control
+  * points. The curve is split into chords by the planner, the chords are
+  * shorter where the curve bends more, so the curve takes a single entry of
+  * the move buffer. The move is joined to the neighbour ones like the
+  * straight ones.
+  */
+Error GoToCurveWithSpeed(double X1, double Y1, double Z1, double X2, double Y2, double Z2,
+                         double X, double Y, double Z, double speed);
+
+/**
+  * @brief The same as GoToCurveWithSpeed(), but returns immediately like
+  * GoToWithSpeedAsync()
+  */
+Error GoToCurveWithSpeedAsync(double X1, double Y1, double Z1, double X2, double Y2, double Z2,
+                              double X, double Y, double Z, double speed, MoveHandle* handle);
+
+/**
+  * @brief Set the tool speed profile of the moves put to the move buffer
+  * after the call. _SCurve limits the jerk of the tool, the moves take
+  * longer to reach the speed.
+  */
+Error SetMotionRamp(Ramp ramp);
+
+/**
+  * @brief Enable or disable the bed mesh compensation of the moves put to
+  * the move buffer after the call. The height of the bed mesh is added to
+  * Z of the tool, so the tool follows the uneven bed. The segments of the
+  * lines, arcs and curves are split at the mesh cell boundaries, where the
+  * height bends. The mesh is loaded
+  * from the flash by InitAllMotors(), see bedMesh.h.
+  */
+Error SetMotionMesh(uint8_t enable);
+
+/**
+  * @brief Check whether the move is finished
+  */
+uint8_t IsMoveDone(MoveHandle handle);
+
+/**
+  * @brief Wait until the move is finished.
+  * The calling task is blocked until the planner and then the step engine
+  * notify it.
+  * Returns _Timeout if the move isn't finished in millisec, or the error
+  * of the planner if the move can't be done.
+  */
+Error WaitForMove(MoveHandle handle, uint32_t millisec);
+
+/**
+  * @brief Wait until all queued moves are finished
+  */
+Error WaitForMotionEnd(void);
+
+/**
+  * @brief Stop the tool as fast as the motors allow, see MotorQuickStop().
+  * The buffered moves are dropped, they are finished with _Aborted, and no
+  * moves are buffered until the motors stop. The current point is set to
+  * the one the tool is stopped at, so the motion may be resumed from it
+  * without homing. Returns when the motors are at rest.
+  */
+Error QuickStopMotion(void);
+
 #endif
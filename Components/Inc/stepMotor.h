@@ -10,10 +10,20 @@
   * Description:
   * Step motor driver implements low-level control interfaces suitable
   * for middl- and high- level layers.
+  * All axises are driven by one step engine, so the moves of different
+  * axises are always started and finished together. The step periods and
+  * the output values are calculated ahead and streamed by DMA, so the
+  * steps don't involve the CPU.
+  * The moves follow either a trapezoidal or a jerk-limited S-curve speed
+  * profile, see MotorSetRamp(). The steps may be passed through an input
+  * shaper cancelling the vibration of the frame, see MotorSetShaper().
+  * The speeds of all moves, the queued ones included, are scaled by the feed
+  * rate override, see MotorSetFeedRate().
   ****Resources being consumed****
-  * TIM9 (with interrupts)
-  * TIM10 (with interrupts)
-  * TIM11 (with interrupts)
+  * TIM8 (the update and compare 1-4 DMA requests)
+  * DMA2 Stream1 channel 7 (with interrupts)
+  * DMA2 Stream2, Stream3, Stream4, Stream7 channel 7
+  * TIM1_TRG_COM_TIM11 IRQ (software triggered, TIM11 itself isn't used)
   */
 
 #ifndef STEP_MOTOR_H_
@@ -33,6 +43,30 @@ typedef enum
   _Z
 } Axis;
 
+#define AXIS_AMOUNT 3   // Specifies the number of axises
+
+/**
+  * @brief Possible speed profiles of a move
+  */
+typedef enum
+{
+  _Trapezoidal,   // Constant acceleration
+  _SCurve         // Acceleration rising from and falling to zero, jerk is limited
+} Ramp;
+
+/**
+  * @brief Possible input shapers
+  */
+typedef enum
+{
+  _NoShaper,      // The steps are output as calculated
+  _ZV,            // Zero vibration, 2 impulses over a half of the vibration period
+  _MZV,           // Modified ZV, 3 impulses over 3/4 of the period, more robust to the frequency error
+  _EI             // Extra insensitive, 3 impulses over the period, the most robust one
+} Shaper;
+
+#define MOTOR_RATE_SHIFT 8  // Specifies the number of fractional bits of step rates
+
 /**
   * @brief Init all drivers
   */
@@ -55,15 +89,60 @@ Error DisableMotor(Axis axis);
 
 /**
   * @brief Set speed and position for the specified axis.
-  * This function also launches the motor
+  * This function also launches the motor. The motor accelerates up to
+  * rpm and decelerates before reaching the angle.
+  * The move is put to the motion queue after the moves already there
   */
 Error MotorSetSpeedAndValue(Axis axis, double rpm, double angle);
 
 /**
-  * @brief Stop a motor
+  * @brief Stop a motor in the move being executed, the other axises go on.
+  * The steps of the axis left in the move are dropped, see MotorHaltAxis().
+  * Nothing is done if the motion queue is idle.
   */
 Error StopMotor(Axis axis);
 
+/**
+  * @brief Stop all motors immediately and flush the motion queue.
+  * The steps done are kept in the angles, the queued moves are finished.
+  * The axises halted by MotorHaltAxis() are released.
+  */
+Error MotorStopAll(void);
+
+/**
+  * @brief Stop stepping the axis at once, the other axises go on.
+  * The steps of the axis left in the move being executed are dropped, so
+  * its angle is the one at the moment of the call. The move ends as soon as
+  * all its axises are halted. The steps dropped are made up by the next
+  * move, so it still reaches its target. If the motion queue is idle, the
+  * axis is halted in the next move queued. It's called by the IRQs of the
+  * end stops and the probe, the priority of such IRQs mustn't be higher
+  * than configLIBRARY_MAX_SYSCALL_INTERRUPT_PRIORITY.
+  */
+Error MotorHaltAxis(Axis axis);
+
+/**
+  * @brief Stop all axises as fast as MOTOR_ACCEL allows.
+  * The move being executed is decelerated right away, the queued moves are
+  * dropped and finished with it. Every step is accounted, so the motion may
+  * be resumed from MotorGetAngle() without homing. The moves can't be queued
+  * until the motors stop, _Aborted is returned by the queue then.
+  * It may be called by any task or IRQ of priority not higher than
+  * configLIBRARY_MAX_SYSCALL_INTERRUPT_PRIORITY.
+  */
+Error MotorQuickStop(void);
+
+/**
+  * @brief Check whether the motors are being stopped by MotorQuickStop()
+  */
+uint8_t IsMotorStopping(void);
+
+/**
+  * @brief Check whether the axis is halted by MotorHaltAxis() in the move
+  * being executed
+  */
+uint8_t IsMotorHalted(Axis axis);
+
 /**
   * @brief Zero out current angle counter value.
   * Call this function by the end-stop signal
@@ -81,4 +160,149 @@ uint8_t IsMotorBusy(Axis axis);
   */
 double MotorGetAngle(Axis axis);
 
+/**
+  * @brief Get current position of all motors, in steps.
+  * steps is indexed by Axis. The positions of all axises are taken at the
+  * same time without disabling the IRQs, so it may be polled at a high rate
+  * without delaying the step engine. It may be called from the IRQs of
+  * priority not higher than configLIBRARY_MAX_SYSCALL_INTERRUPT_PRIORITY
+  * to latch the position at an event.
+  */
+void MotorGetSteps(int32_t steps[AXIS_AMOUNT]);
+
+/**
+  * @brief Put a coordinated move of all axises to the motion queue.
+  * The move is started by the driver as soon as the previous one is
+  * finished, so consecutive moves are executed back to back.
+  * rpm and angle are indexed by Axis. The move is executed with the rpm
+  * of the axis having the most steps, the other axises follow it.
+  * Returns _QueueFull if there is no room for the move.
+  */
+Error MotorQueueMove(const double rpm[AXIS_AMOUNT], const double angle[AXIS_AMOUNT]);
+
+/**
+  * @brief Put a coordinated move of all axises to the motion queue.
+  * The same as MotorQueueMove(), but the move is entered with entry*rpm
+  * and left with exit*rpm instead of stopping, 0 <= entry, exit <= 1.
+  * The caller is responsible for the speeds of consecutive moves to match.
+  */
+Error MotorQueueMoveEx(const double rpm[AXIS_AMOUNT], const double angle[AXIS_AMOUNT],
+                       double entry, double exit);
+
+/**
+  * @brief Put a coordinated move of all axises to the motion queue.
+  * The same as MotorQueueMoveEx(), but target is the angle of every axis in
+  * steps and the speeds are the step rates (steps/s with MOTOR_RATE_SHIFT
+  * fractional bits) of the axis having the most steps. The move profile is
+  * calculated with integers only, use this function for short segments.
+  */
+Error MotorQueueMoveRate(const int32_t target[AXIS_AMOUNT],
+                         uint32_t rate, uint32_t entry_rate, uint32_t exit_rate);
+
+/**
+  * @brief Set the speed profile of the moves put to the motion queue
+  * after the call, the moves already queued keep their profiles.
+  * The S-curve profile reaches the same speed with the same peak
+  * acceleration, but takes about twice as many steps to do it.
+  */
+Error MotorSetRamp(Ramp ramp);
+
+/**
+  * @brief Set the input shaper of all axises.
+  * The motion is convolved with the impulses cancelling the vibration of
+  * the frequency (Hz) and the damping ratio (0 <= damping < 1) specified,
+  * so the corners are smoothed over the shaper duration and the moves end
+  * that much later. The shaper is applied when the motion queue is started
+  * next time, the moves already being executed aren't affected.
+  */
+Error MotorSetShaper(Shaper shaper, float freq, float damping);
+
+/**
+  * @brief Set the feed rate override, percent of the speeds of the moves.
+  * The step periods are scaled as they are calculated, so the moves being
+  * executed and the queued ones speed up or slow down without replanning.
+  * The speed follows the override within the acceleration limit. A move is
+  * sped up no more than by the override in effect when it's queued: its
+  * ramps are planned for that speed, and it isn't taken beyond 600 rpm.
+  * Slowing down affects all the moves.
+  * It may be called by any task or IRQ at any time.
+  */
+Error MotorSetFeedRate(uint32_t percent);
+
+/**
+  * @brief Get the feed rate override, percent
+  */
+uint32_t MotorGetFeedRate(void);
+
+/**
+  * @brief Convert the angle to the nearest number of steps
+  */
+int32_t MotorAngleToSteps(float angle);
+
+/**
+  * @brief Convert the number of steps to the angle
+  */
+float MotorStepsToAngle(int32_t steps);
+
+/**
+  * @brief Get the number of free entries in the motion queue
+  */
+uint32_t MotorQueueGetFree(void);
+
+/**
+  * @brief Check whether the motion queue is still being executed
+  */
+uint8_t IsMotorQueueBusy(void);
+
+/**
+  * @brief Get the number of the last move put to the motion queue
+  */
+uint32_t MotorQueueGetLast(void);
+
+/**
+  * @brief Get the number of the move being executed, the number of the
+  * next move queued if the motion queue is idle. It may be called by IRQs
+  * of priority not higher than configLIBRARY_MAX_SYSCALL_INTERRUPT_PRIORITY.
+  */
+uint32_t MotorQueueGetCurrent(void);
+
+/**
+  * @brief Check whether the move with the number specified is finished
+  */
+uint8_t IsMotorMoveDone(uint32_t move);
+
+/**
+  * @brief Wait until the move with the number specified is finished.
+  * The calling task is blocked and woken up by the step engine, so it
+  * doesn't consume CPU time while waiting. Several tasks may wait at a time.
+  * Returns _Timeout if the move isn't finished in millisec and _QueueFull
+  * if there are too many tasks waiting.
+  */
+Error MotorWaitMove(uint32_t move, uint32_t millisec);
+
+/**
+  * @brief Send the signal to the calling task when the move with the number
+  * specified is finished, without blocking the task. The request is dropped
+  * once the signal is sent or by MotorCancelSignal().
+  * Returns _QueueFull if there are too many tasks waiting.
+  */
+Error MotorSignalMove(uint32_t move, int32_t signal);
+
+/**
+  * @brief Drop the requests of the calling task made by MotorSignalMove()
+  */
+void MotorCancelSignal(void);
+
+/**
+  * @brief Wait until the move being executed is finished.
+  * Returns immediately if the motion queue is idle.
+  */
+Error MotorQueueWaitNext(uint32_t millisec);
+
+/**
+  * @brief Wait until there is room in the motion queue.
+  * Returns _Timeout if the queue is still full in millisec.
+  */
+Error MotorQueueWaitFree(uint32_t millisec);
+
 #endif
@@ -0,0 +1,186 @@
+/**
+  ******************************************************************************
+  * @file    bedMesh.c
+  * @author  Nikita lazarev <nikitaterm@gmail.com>
+  * @version V1.01
+  * @date    29-May-2016
+  * @brief   Source file of the bed mesh module.
+  ******************************************************************************
+  */
+
+#include "stm32f4xx_hal.h"
+
+#include "bedMesh.h"
+
+#include "math.h"
+#include "stddef.h"
+
+#define BED_MESH_FLASH_SECTOR FLASH_SECTOR_11
+#define BED_MESH_FLASH_ADDR   0x080E0000
+#define BED_MESH_MAGIC        0x4D455348  // "MESH"
+#define BED_MESH_Z_SCALE      1000        // Specifies the number of the stored height units per mm
+
+/**
+  * @brief Bed mesh, it's stored to the flash as is
+  */
+typedef struct
+{
+  uint32_t magic;                 /**< BED_MESH_MAGIC if the mesh is valid */
+
+  float X0, Y0;                   /**< First point, mm */
+
+  float dX, dY;                   /**< Distance between the points, mm */
+
+  uint16_t nX, nY;                /**< Number of the points along the axises, 0 if there is no mesh */
+
+  int16_t Z[BED_MESH_MAX_Y*BED_MESH_MAX_X];  /**< Heights, 1/BED_MESH_Z_SCALE mm */
+
+  uint32_t checksum;              /**< Checksum of all the words above */
+
+} BedMesh_TypeDef;
+
+static BedMesh_TypeDef mesh;
+
+/**
+  * @brief Get the checksum of the mesh
+  */
+static uint32_t GetChecksum(const BedMesh_TypeDef* m)
+{
+  const uint32_t* word = (const uint32_t*)m;
+  uint32_t sum = 0;
+  for (uint32_t i = 0; i < offsetof(BedMesh_TypeDef, checksum)/4; i++)
+  {
+    sum = ((sum << 1) | (sum >> 31)) + word[i];
+  }
+  return sum;
+}
+
+/**
+  * @brief Get the next boundary of the cells along one axis, see
+  * BedMeshNextBoundary(). p is the coordinate at t, d is its change over
+  * the line.
+  */
+static float NextLine(float p, float d, float origin, float cell, uint32_t n, float t)
+{
+  if (d == 0) return 1;
+  float f = (p - origin)/cell;
+  int32_t m;
+  if (d > 0)
+  {
+    m = (int32_t)floorf(f) + 1;
+    if (m < 0) m = 0;
+    if (m > (int32_t)n - 1) return 1;
+  }
+  else
+  {
+    m = (int32_t)ceilf(f) - 1;
+    if (m > (int32_t)n - 1) m = n - 1;
+    if (m < 0) return 1;
+  }
+  float next = t + (origin + m*cell - p)/d;
+  return (next < 1) ? next : 1;
+}
+
+/* Public functions */
+
+Error BedMeshLoad(void)
+{
+  const BedMesh_TypeDef* stored = (const BedMesh_TypeDef*)BED_MESH_FLASH_ADDR;
+  if ( (stored->magic != BED_MESH_MAGIC) || (stored->checksum != GetChecksum(stored)) )
+  {
+    BedMeshClear();
+    return _OutOfRange;
+  }
+  mesh = *stored;
+  return _Success;
+}
+
+Error BedMeshSave(void)
+{
+  Error err = _Success;
+  FLASH_EraseInitTypeDef erase;
+  uint32_t sector_error;
+  const uint32_t* word = (const uint32_t*)&mesh;
+  mesh.checksum = GetChecksum(&mesh);
+  if (HAL_FLASH_Unlock() != HAL_OK) return _HALError;
+  erase.TypeErase = FLASH_TYPEERASE_SECTORS;
+  erase.Sector = BED_MESH_FLASH_SECTOR;
+  erase.NbSectors = 1;
+  erase.VoltageRange = FLASH_VOLTAGE_RANGE_3;
+  if (HAL_FLASHEx_Erase(&erase, &sector_error) != HAL_OK)
+  {
+    err = _HALError;
+    goto e;
+  }
+  for (uint32_t i = 0; i < sizeof(mesh)/4; i++)
+  {
+    if (HAL_FLASH_Program(FLASH_TYPEPROGRAM_WORD, BED_MESH_FLASH_ADDR + 4*i, word[i]) != HAL_OK)
+    {
+      err = _HALError;
+      goto e;
+    }
+  }
+  e:
+  HAL_FLASH_Lock();
+  return err;
+}
+
+Error BedMeshSet(float X0, float Y0, float dX, float dY, uint32_t nX, uint32_t nY, const float* Z)
+{
+  if ( (nX < 2) || (nX > BED_MESH_MAX_X) || (nY < 2) || (nY > BED_MESH_MAX_Y) ) return _OutOfRange;
+  if ( !(dX > 0) || !(dY > 0) ) return _OutOfRange;
+  for (uint32_t i = 0; i < nX*nY; i++)
+  {
+    if ( !(fabsf(Z[i])*BED_MESH_Z_SCALE < INT16_MAX) ) return _OutOfRange;  // Also catches NaN
+  }
+  mesh.magic = BED_MESH_MAGIC;
+  mesh.X0 = X0;
+  mesh.Y0 = Y0;
+  mesh.dX = dX;
+  mesh.dY = dY;
+  mesh.nX = nX;
+  mesh.nY = nY;
+  for (uint32_t i = 0; i < BED_MESH_MAX_Y*BED_MESH_MAX_X; i++)
+  {
+    float z = (i < nX*nY) ? Z[i]*BED_MESH_Z_SCALE : 0;
+    mesh.Z[i] = (int16_t)((z < 0) ? z - 0.5f : z + 0.5f);
+  }
+  return _Success;
+}
+
+void BedMeshClear(void)
+{
+  mesh.magic = 0;
+  mesh.nX = 0;
+  mesh.nY = 0;
+}
+
+float BedMeshGetZ(float X, float Y)
+{
+  if (mesh.nX == 0) return 0;
+  float fx = (X - mesh.X0)/mesh.dX;
+  float fy = (Y - mesh.Y0)/mesh.dY;
+  if (!(fx > 0)) fx = 0;
+  if (!(fy > 0)) fy = 0;
+  if (fx > (float)(mesh.nX - 1)) fx = (float)(mesh.nX - 1);
+  if (fy > (float)(mesh.nY - 1)) fy = (float)(mesh.nY - 1);
+  uint32_t i = (uint32_t)fx;
+  uint32_t j = (uint32_t)fy;
+  if (i > (uint32_t)(mesh.nX - 2)) i = mesh.nX - 2;
+  if (j > (uint32_t)(mesh.nY - 2)) j = mesh.nY - 2;
+  float t = fx - i;
+  float u = fy - j;
+  const int16_t* row0 = &mesh.Z[j*mesh.nX + i];
+  const int16_t* row1 = row0 + mesh.nX;
+  float z0 = row0[0] + t*(row0[1] - row0[0]);
+  float z1 = row1[0] + t*(row1[1] - row1[0]);
+  return (z0 + u*(z1 - z0))*(1.0f/BED_MESH_Z_SCALE);
+}
+
+float BedMeshNextBoundary(float X, float Y, float dx, float dy, float t)
+{
+  if (mesh.nX == 0) return 1;
+  float next_x = NextLine(X + dx*t, dx, mesh.X0, mesh.dX, mesh.nX, t);
+  float next_y = NextLine(Y + dy*t, dy, mesh.Y0, mesh.dY, mesh.nY, t);
+  return (next_x < next_y) ? next_x : next_y;
+}
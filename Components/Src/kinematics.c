@@ -0,0 +1,249 @@
+/**
+  ******************************************************************************
+  * @file    kinematics.c
+  * @author  Nikita lazarev <nikitaterm@gmail.com>
+  * @version V1.01
+  * @date    29-May-2016
+  * @brief   Source file of the inverse kinematics module.
+  ******************************************************************************
+  */
+
+#include "kinematics.h"
+#include "kinematicsLookUp.h"
+
+#include "math.h"
+
+/** Specifies the length (in mm) of all mechanism elements.
+  * Please, refer to the Kinematic.png file for the
+  * graphic representation.
+  */
+#define OD 241.0996
+#define OE 241.0996
+#define DF 284.2327
+#define EG 284.2327
+#define OOD 82
+#define OOE 82
+/** Specifies the angle's values (in grads) of the elements
+  * DF and GE in the initial position.
+  */
+#define Ix (90 - 2.3188)
+#define Iy (90 - 2.3188)
+
+#define PI_F   3.14159265f
+#define PI_2_F 1.57079633f
+
+/** Specifies how far (in parts of 1) the acos argument may exceed 1 due to
+  * the rounding errors, such values are clamped.
+  */
+#define ACOS_ARG_EPS 1e-5f
+
+/**
+  * @brief acos(x) for 0 <= x <= 1, the max error is 2e-8 rad.
+  * Abramowitz and Stegun, formula 4.4.46.
+  */
+static float AcosPos(float x)
+{
+  float p = -0.0012624911f;
+  p = p*x + 0.0066700901f;
+  p = p*x - 0.0170881256f;
+  p = p*x + 0.0308918810f;
+  p = p*x - 0.0501743046f;
+  p = p*x + 0.0889789874f;
+  p = p*x - 0.2145988016f;
+  p = p*x + 1.5707963050f;
+  return sqrtf(1.0f - x)*p;
+}
+
+static float Acos(float x)
+{
+  return (x >= 0) ? AcosPos(x) : PI_F - AcosPos(-x);
+}
+
+/**
+  * @brief atan(x) for -1 <= x <= 1, the max error is 2e-8 rad.
+  * Abramowitz and Stegun, formula 4.4.49.
+  */
+static float AtanUnit(float x)
+{
+  float x2 = x*x;
+  float p = 0.0028662257f;
+  p = p*x2 - 0.0161657367f;
+  p = p*x2 + 0.0429096138f;
+  p = p*x2 - 0.0752896400f;
+  p = p*x2 + 0.1065626393f;
+  p = p*x2 - 0.1420889944f;
+  p = p*x2 + 0.1999355085f;
+  p = p*x2 - 0.3333314528f;
+  return x + x*x2*p;
+}
+
+static float Atan(float x)
+{
+  if (x > 1.0f) return PI_2_F - AtanUnit(1.0f/x);
+  if (x < -1.0f) return -PI_2_F - AtanUnit(1.0f/x);
+  return AtanUnit(x);
+}
+
+/**
+  * @brief Get the angle of the lever, a and b are the coordinates of the
+  * tool in the plane of the lever.
+  */
+static Error GetLeverAngle(float a, float b, float arm, float rod, float *angle)
+{
+  float l2 = a*a + b*b;
+  float x = (rod*rod - arm*arm + l2)/(2*rod*sqrtf(l2));
+  if (!(fabsf(x) <= 1.0f + ACOS_ARG_EPS)) return _OutOfRange;  // Also catches NaN
+  if (x > 1.0f) x = 1.0f;
+  if (x < -1.0f) x = -1.0f;
+  *angle = Acos(x);
+  return _Success;
+}
+
+static Error GetLeverAngleRef(double a, double b, double arm, double rod, double *angle)
+{
+  double x = (rod*rod - arm*arm + a*a + b*b)/(2*rod*sqrt(a*a + b*b));
+  if (!(fabs(x) <= 1.0)) return _OutOfRange;
+  *angle = acos(x);
+  return _Success;
+}
+
+/**
+  * @brief Interpolate the lever angle over the look-up table.
+  * Returns 0 if the point is out of the table.
+  */
+static uint8_t LookUp(const float table[KIN_LU_Z_SIZE][KIN_LU_A_SIZE], float a, float z, float *angle)
+{
+  float fa = (a - KIN_LU_A_MIN)*(1.0f/KIN_LU_STEP);
+  float fz = (z - KIN_LU_Z_MIN)*(1.0f/KIN_LU_STEP);
+  if ( !(fa >= 0 && fa <= KIN_LU_A_SIZE - 1) || !(fz >= 0 && fz <= KIN_LU_Z_SIZE - 1) ) return 0;
+  uint32_t i = (uint32_t)fa;
+  uint32_t j = (uint32_t)fz;
+  if (i > KIN_LU_A_SIZE - 2) i = KIN_LU_A_SIZE - 2;
+  if (j > KIN_LU_Z_SIZE - 2) j = KIN_LU_Z_SIZE - 2;
+  float t = fa - i;
+  float u = fz - j;
+  float v0 = table[j][i] + t*(table[j][i + 1] - table[j][i]);
+  float v1 = table[j + 1][i] + t*(table[j + 1][i + 1] - table[j + 1][i]);
+  *angle = v0 + u*(v1 - v0);
+  return 1;
+}
+
+/**
+  * @brief Get the derivatives of the lever angle by a and b, see
+  * GetLeverAngle() for the arguments.
+  */
+static Error GetLeverDerivatives(float a, float b, float arm, float rod, float *d_a, float *d_b)
+{
+  float l2 = a*a + b*b;
+  float l = sqrtf(l2);
+  float x = (rod*rod - arm*arm + l2)/(2*rod*l);
+  float s = 1.0f - x*x;
+  if (!(s > 0)) return _OutOfRange;  // The lever is fully folded or unfolded
+  // d(acos(x))/dl = -(dx/dl)/sqrt(1-x^2), dx/dl = (l^2-rod^2+arm^2)/(2*rod*l^2)
+  float d_l = -(l2 - rod*rod + arm*arm)/(2*rod*l2)/sqrtf(s);
+  *d_a = d_l*a/l;
+  *d_b = d_l*b/l;
+  return _Success;
+}
+
+/* Public functions */
+
+Error KinGetAngles(float X, float Y, float Z, float angle[AXIS_AMOUNT])
+{
+  Error err = _Success;
+  float lever;
+  // atan(Z/Y) and atan(Z/X) have no limit at Y = Z = 0 and X = Z = 0.
+  if ( (Z == 0) && ((X == 0) || (Y == 0)) ) return _OutOfRange;
+  err = GetLeverAngle(Y + (float)OOE, Z, (float)OE, (float)EG, &lever);
+  if (err != _Success) goto e;
+  angle[_X] = X*(float)Kx - (float)Ix + lever + Atan(Z/Y);
+  err = GetLeverAngle(X + (float)OOD, Z, (float)OD, (float)DF, &lever);
+  if (err != _Success) goto e;
+  angle[_Y] = Y*(float)Ky - (float)Iy + lever + Atan(Z/X);
+  angle[_Z] = Z*(float)Kz;
+  return _Success;
+  e:
+  return err;
+}
+
+Error KinGetAnglesRef(double X, double Y, double Z, double angle[AXIS_AMOUNT])
+{
+  Error err = _Success;
+  double lever;
+  if ( (Z == 0) && ((X == 0) || (Y == 0)) ) return _OutOfRange;  // atan(0/0)
+  err = GetLeverAngleRef(Y + OOE, Z, OE, EG, &lever);
+  if (err != _Success) goto e;
+  angle[_X] = X*Kx - Ix + lever + atan(Z/Y);
+  err = GetLeverAngleRef(X + OOD, Z, OD, DF, &lever);
+  if (err != _Success) goto e;
+  angle[_Y] = Y*Ky - Iy + lever + atan(Z/X);
+  angle[_Z] = Z*Kz;
+  return _Success;
+  e:
+  return err;
+}
+
+Error KinGetPoint(const double angle[AXIS_AMOUNT], double point[3])
+{
+  const double K[AXIS_AMOUNT] = {Kx, Ky, Kz};
+  double guess[AXIS_AMOUNT];
+  for (uint32_t i = 0; i < KIN_POINT_ITERATIONS; i++)
+  {
+    Error err = KinGetAnglesRef(point[0], point[1], point[2], guess);
+    if (err != _Success) return err;
+    double max_d = 0;
+    for (uint8_t j = 0; j < AXIS_AMOUNT; j++)
+    {
+      double d = (angle[j] - guess[j])/K[j];
+      if (isnan(d)) return _OutOfRange;  // atan(0/0) at X = 0 or Y = 0
+      if (fabs(d) > max_d) max_d = fabs(d);
+      point[j] += d;
+    }
+    if (max_d <= KIN_POINT_TOLERANCE) return _Success;
+  }
+  return _OutOfRange;
+}
+
+Error KinLookUpAngles(float X, float Y, float Z, float angle[AXIS_AMOUNT])
+{
+  float lever_x, lever_y;
+  if (!LookUp(kin_x_lu, Y, Z, &lever_x) || !LookUp(kin_y_lu, X, Z, &lever_y))
+  {
+    return KinGetAngles(X, Y, Z, angle);
+  }
+  angle[_X] = X*(float)Kx + lever_x;
+  angle[_Y] = Y*(float)Ky + lever_y;
+  angle[_Z] = Z*(float)Kz;
+  return _Success;
+}
+
+Error KinGetJacobian(float X, float Y, float Z, float J[AXIS_AMOUNT][AXIS_AMOUNT])
+{
+  Error err = _Success;
+  float d_a, d_z;
+  // d(atan(Z/A))/dA = -Z/(A^2+Z^2), d(atan(Z/A))/dZ = A/(A^2+Z^2)
+  float r2;
+
+  err = GetLeverDerivatives(Y + (float)OOE, Z, (float)OE, (float)EG, &d_a, &d_z);
+  if (err != _Success) goto e;
+  r2 = Y*Y + Z*Z;
+  if (r2 == 0) return _OutOfRange;  // atan(0/0)
+  J[_X][_X] = Kx;
+  J[_X][_Y] = d_a - Z/r2;
+  J[_X][_Z] = d_z + Y/r2;
+
+  err = GetLeverDerivatives(X + (float)OOD, Z, (float)OD, (float)DF, &d_a, &d_z);
+  if (err != _Success) goto e;
+  r2 = X*X + Z*Z;
+  if (r2 == 0) return _OutOfRange;  // atan(0/0)
+  J[_Y][_X] = d_a - Z/r2;
+  J[_Y][_Y] = Ky;
+  J[_Y][_Z] = d_z + X/r2;
+
+  J[_Z][_X] = 0;
+  J[_Z][_Y] = 0;
+  J[_Z][_Z] = Kz;
+  return _Success;
+  e:
+  return err;
+}
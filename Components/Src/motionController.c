@@ -11,40 +11,260 @@
 // TODO: This module hasn't been tested yet!!!
 
 #include "stm32f4xx_hal.h"
+#include "cmsis_os.h"
 
 #include "motionController.h"
 #include "stepMotor.h"
+#include "kinematics.h"
+#include "bedMesh.h"
 
 #include "math.h"
 
-/** Specifies the length (in mm) of all mechanism elements.
-  * Please, refer to the Kinematic.png file for the
-  * graphic representation.
+#define SEGMENT_LENGTH 1.0f  // Specifies the max length of a move segment, mm
+#define MOTION_ACCEL   100   // Specifies the tool acceleration, mm/s^2
+/** Specifies the limits of the motors. The tool speed and acceleration of
+  * a move are reduced, so that no motor exceeds them anywhere on the move.
+  * MOTION_MAX_ACCEL mustn't exceed the acceleration of the drivers.
   */
-#define OD 241.0996
-#define OE 241.0996
-#define DF 284.2327
-#define EG 284.2327
-#define OOD 82
-#define OOE 82
-/** Specifies the transformation values of all axises.
+#define MOTION_MAX_RPM   600  // rpm
+#define MOTION_MAX_ACCEL 500  // rpm/s
+/** Specifies how far (in mm) the tool may deviate from the corner of two
+  * moves. The tool passes the corner with the speed of the circular path
+  * of such deviation, so the smaller the angle is the faster it goes.
   */
-#define Kx 72  // =360/screw_step (in mm)
-#define Ky 72  // =360/screw_step (in mm)
-#define Kz 120  // =360/screw_step (in mm)
-/** Specifies the angle's values (in grads) of the elements
-  * DF and GE in the initial position.
+#define MOTION_JUNCTION_DEVIATION 0.05f
+/** The arcs are split into chords deviating from the arc by ARC_TOLERANCE
+  * at most. The chord ends are got by rotating the radius by the same angle
+  * every time, the rounding errors of the rotation are removed by getting
+  * every ARC_CORRECTION-th chord end exactly.
   */
-#define Ix 90 - 2.3188
-#define Iy 90 - 2.3188
+#define ARC_TOLERANCE        0.01f  // mm
+#define ARC_RADIUS_TOLERANCE 0.05f  // Specifies how far (in mm) the end point may be off the arc
+#define ARC_CORRECTION       16
+#define PI_F                 3.14159265f
+
+/** The cubic Bezier curves are split into chords deviating from the curve
+  * by CURVE_TOLERANCE at most. The chord is halved until it's flat enough
+  * and doubled while it's still flat, so the chords are short where the
+  * curve bends only. The curve is walked by forward differencing of its
+  * derivatives, the chords are 1/2^n of the curve parameter.
+  */
+#define CURVE_TOLERANCE 0.01f       // mm
+#define CURVE_MIN_STEP  (1.0f/65536) // Specifies the shortest chord, in parts of the curve parameter
+
+/** Specifies the shortest piece (in mm) of a segment split off by the bed
+  * mesh cell boundaries, the closer boundaries are ignored.
+  */
+#define BED_MESH_MIN_SPLIT 0.05f
+
+/** The end stops halt their axises by IRQ, so the axises stop at the very
+  * step the end stops are hit at. The end stops are approached fast first
+  * and then slowly, after backing off, to be hit at the accurate position.
+  */
+#define END_STOP_IRQ              EXTI9_5_IRQn
+#define END_STOP_IRQ_PR_PRIORITY  5     // Must not be higher than configLIBRARY_MAX_SYSCALL_INTERRUPT_PRIORITY
+#define END_STOP_IRQ_SUB_PRIORITY 0
+#define HOMING_FAST_RPM 300    // Specifies the speed to approach the end stops, rpm
+#define HOMING_SLOW_RPM 30     // Specifies the speed to approach the end stops again, rpm
+#define HOMING_TRAVEL   36000  // Specifies the max angle to move to the end stops by, grads
+#define HOMING_BACK_OFF 10     // Specifies the angle to back off the end stops by, grads
+#define HOMING_BACK_OFF_TRIES 4  // Specifies the max number of back-offs to release an end stop
+
+/** The probe latches the steps of all axises by IRQ at the edge it's
+  * triggered at and halts them, so the point probed doesn't depend on the
+  * task latency. The halt ends the descent, and the retract queued after it
+  * makes up the steps dropped, so the moves of the next points are queued
+  * ahead and the points are probed back to back.
+  */
+#define PROBE_PIN              GPIO_PIN_4
+#define PROBE_IRQ              EXTI4_IRQn
+#define PROBE_IRQ_PR_PRIORITY  5     // Must not be higher than configLIBRARY_MAX_SYSCALL_INTERRUPT_PRIORITY
+#define PROBE_IRQ_SUB_PRIORITY 0
+#define PROBE_TRAVEL_SPEED     20    // Specifies the tool speed between the points probed, mm/s
+#define PROBE_AHEAD            2     // Specifies the number of points whose moves are queued, must be a power of 2
+
+#define MOVE_BUFFER_SIZE   16   // Specifies the number of moves waiting for the planner, must be a power of 2
+#define PLANNER_PRIORITY   osPriorityAboveNormal
+#define PLANNER_STACK_SIZE 256  // Specifies the planner task's stack size, words
+#define PLANNER_SIGNAL     0x01 // Specifies the signal of a new move or of the motor queue getting low
+#define MOTION_SIGNAL      0x02 // Specifies the signal of a planned move sent to the waiting tasks
+#define MOTION_WAITERS     4    // Specifies the max number of tasks waiting for the planner at a time
+/** The last buffered move is held back while the motor queue has more than
+  * PLANNER_LOW_BLOCKS segments to execute, so the next move can be joined
+  * to it without stopping. The motor queue signals the planner when it gets low.
+  */
+#define PLANNER_LOW_BLOCKS  4
+
+/**
+  * @brief Possible paths of the tool
+  */
+typedef enum
+{
+  _Line,
+  _Arc,           // Arc in the XY plane, Z changes linearly along it
+  _Curve          // Cubic Bezier curve
+} Motion_PathType;
+
+/**
+  * @brief Move waiting for the planner.
+  * The moves are prepared as soon as they are buffered, the entry speeds
+  * are replanned every time a move is prepared.
+  */
+typedef struct
+{
+  float from_X, from_Y, from_Z;   /**< Start point, mm */
+
+  float X, Y, Z;                  /**< End point, mm */
+
+  Motion_PathType path;           /**< Path from the start point to the end one */
+
+  float c_X, c_Y;                 /**< Center of the arc, mm */
+
+  float theta;                    /**< Angle of the arc, rad, positive is counterclockwise */
+
+  float cos_t, sin_t;             /**< Rotation of the radius by an arc chord, set by the planner */
+
+  float c1[3], c2[3];             /**< Control points of the curve (X, Y, Z), mm */
+
+  float speed;                    /**< Tool speed, mm/s, limited by the planner */
+
+  Ramp ramp;                      /**< Tool speed profile */
+
+  uint8_t mesh;                   /**< Whether the bed mesh is applied to Z */
+
+  float accel;                    /**< Tool acceleration, mm/s^2, set by the planner */
+
+  float l;                        /**< Length of the move, mm, set by the planner */
+
+  uint32_t n;                     /**< Number of segments, set by the planner */
+
+  float max_entry;                /**< Max speed to enter the move with, mm/s, set by the planner */
+
+  float entry;                    /**< Planned speed to enter the move with, mm/s */
+
+  uint32_t last_block;            /**< Number of the last motor queue move of the move, set by the planner */
+
+  Error err;                      /**< Result of the planning, set by the planner */
+
+} Motion_MoveTypeDef;
+
+/**
+  * @brief Tool speed profile of a move being split into segments
+  */
+typedef struct
+{
+  Ramp ramp;                      /**< Profile type */
+
+  float entry;                    /**< Entry speed, mm/s */
+
+  float exit;                     /**< Exit speed, mm/s */
+
+  float peak;                     /**< Cruise speed, mm/s */
+
+  float accel;                    /**< Acceleration, mm/s^2 */
+
+  float accel_l;                  /**< Length of the acceleration, mm */
+
+  float decel_l;                  /**< Length of the deceleration, mm */
+
+} Motion_ProfileTypeDef;
+
+/**
+  * @brief Point of a move being split into segments
+  */
+typedef struct
+{
+  float X, Y, Z;                  /**< Point, mm */
+
+  float r_X, r_Y;                 /**< Radius of the arc at the point, mm */
+
+  uint32_t i;                     /**< Number of the arc chords passed */
+
+  float t, h;                     /**< Curve parameter at the point and of the last chord */
+
+  float d1[3], d2[3], d3[3];      /**< First, second and third derivatives of the curve at the point */
+
+} Motion_PathPointTypeDef;
+
+/**
+  * @brief Where the probe is triggered at a point
+  */
+typedef enum
+{
+  _NotHit,
+  _HitDescent,    // The point is probed
+  _HitTravel      // The tool has run into something
+} Motion_ProbeHit;
+
+/**
+  * @brief Point whose moves are queued for probing
+  */
+typedef struct
+{
+  float X, Y;                     /**< Point, mm */
+
+  uint32_t index;                 /**< Index of the point in the grid */
+
+  volatile uint32_t travel;       /**< Number of the first motor queue move of the travel to the point */
+
+  volatile uint32_t descent;      /**< Number of the motor queue move of the descent */
+
+  volatile uint8_t armed;         /**< The probe IRQ may latch the point */
+
+  volatile Motion_ProbeHit hit;   /**< Where the probe is triggered, set by the probe IRQ */
+
+  int32_t steps[AXIS_AMOUNT];     /**< Steps of all axises latched at the trigger */
+
+} Motion_ProbePointTypeDef;
+
+/**
+  * @brief Task waiting for the planner
+  */
+typedef struct
+{
+  volatile osThreadId thread;     /**< Waiting task, NULL if the entry is free */
+
+  volatile uint32_t move;         /**< Number of the buffered move the task is waiting for */
+
+} Motion_WaiterTypeDef;
+
+/** The move buffer.
+  * The buffer is filled by GoToWithSpeedAsync() and emptied by the planner
+  * task, which splits the moves into segments and feeds them to the motor
+  * queue, so the callers don't wait for the segments to be calculated.
+  * The moves buffered are the look-ahead of the planner: a move is left
+  * with the speed the next one can be entered with and stopped from in time.
+  */
+static Motion_MoveTypeDef moves[MOVE_BUFFER_SIZE];
+static volatile uint32_t moves_head;      // Written by the callers only
+static volatile uint32_t moves_planned;   // Written by the planner only
+static uint32_t moves_prepared;           // Written by the planner only
+static float last_u[3];                   // Direction of the last move prepared
+static float last_speed;                  // Speed of the last move prepared, 0 if the tool stops after it
+static float last_accel;                  // Acceleration of the last move prepared
+static float planned_exit;                // Speed the last planned move is left with, mm/s
+static osThreadId planner;
+static Ramp motion_ramp;                  // Profile of the moves being buffered
+static uint8_t motion_mesh;               // Whether the bed mesh is applied to the moves being buffered
+static volatile osThreadId motion_stopping;  // Task executing QuickStopMotion(), no moves are buffered
+static volatile uint8_t moves_dropped;    // The planner has dropped the buffered moves since the stop
+static Motion_WaiterTypeDef moves_waiters[MOTION_WAITERS];
+
+static const uint16_t end_stop_pins[AXIS_AMOUNT] = {GPIO_PIN_5, GPIO_PIN_6, GPIO_PIN_7};
+static volatile uint8_t end_stops_armed;  // Mask of the axises to be halted by their end stops
+
+static Motion_ProbePointTypeDef probe_points[PROBE_AHEAD];  // Points queued, indexed by their order
 
 double curr_X, curr_Y, curr_Z;
 
+static void PlannerTask(void const *argument);
+
 void InitEndStops()
 {
   GPIO_InitTypeDef GPIO_InitStruct;
-  GPIO_InitStruct.Mode = GPIO_MODE_INPUT;
+  GPIO_InitStruct.Mode = GPIO_MODE_IT_FALLING;  // The end stop is hit
   GPIO_InitStruct.Pull = GPIO_PULLUP;
+  __GPIOE_CLK_ENABLE();
 
   // Init the GPIO PORTE.5 for the X-axis end stop.
   GPIO_InitStruct.Pin = GPIO_PIN_5;
@@ -57,21 +277,138 @@ void InitEndStops()
   // Init the GPIO PORTE.7 for the Z-axis end stop.
   GPIO_InitStruct.Pin = GPIO_PIN_7;
   HAL_GPIO_Init(GPIOE, &GPIO_InitStruct);
+
+  HAL_NVIC_SetPriority(END_STOP_IRQ, END_STOP_IRQ_PR_PRIORITY, END_STOP_IRQ_SUB_PRIORITY);
+  HAL_NVIC_EnableIRQ(END_STOP_IRQ);
 }
 
-static double GetXAngle(double X, double Y, double Z)
+void EXTI9_5_IRQHandler(void)
 {
-  return X*Kx-Ix+acos((EG*EG-OE*OE+(Y+OOE)*(Y+OOE)+Z*Z)/(2*EG*sqrt((Y+OOE)*(Y+OOE)+Z*Z)))+atan(Z/Y);
+  for (uint8_t i = 0; i < AXIS_AMOUNT; i++)
+  {
+    if (__HAL_GPIO_EXTI_GET_IT(end_stop_pins[i]) == RESET) continue;
+    __HAL_GPIO_EXTI_CLEAR_IT(end_stop_pins[i]);
+    if (end_stops_armed & (1 << i))
+    {
+      MotorHaltAxis((Axis)i);
+      end_stops_armed &= ~(1 << i);
+    }
+  }
 }
 
-static double GetYAngle(double X, double Y, double Z)
+static void InitProbe(void)
 {
-  return Y*Ky-Iy+acos((DF*DF-OD*OD+(X+OOD)*(X+OOD)+Z*Z)/(2*DF*sqrt((X+OOD)*(X+OOD)+Z*Z)))+atan(Z/X);
+  GPIO_InitTypeDef GPIO_InitStruct;
+  GPIO_InitStruct.Mode = GPIO_MODE_IT_FALLING;  // The probe is triggered
+  GPIO_InitStruct.Pull = GPIO_PULLUP;
+  __GPIOE_CLK_ENABLE();
+
+  // Init the GPIO PORTE.4 for the Z-probe.
+  GPIO_InitStruct.Pin = PROBE_PIN;
+  HAL_GPIO_Init(GPIOE, &GPIO_InitStruct);
+
+  HAL_NVIC_SetPriority(PROBE_IRQ, PROBE_IRQ_PR_PRIORITY, PROBE_IRQ_SUB_PRIORITY);
+  HAL_NVIC_EnableIRQ(PROBE_IRQ);
 }
 
-static double GetZAngle(double Z)
+void EXTI4_IRQHandler(void)
 {
-  return Z*Kz;
+  __HAL_GPIO_EXTI_CLEAR_IT(PROBE_PIN);
+  uint32_t move = MotorQueueGetCurrent();
+  for (uint8_t k = 0; k < PROBE_AHEAD; k++)
+  {
+    Motion_ProbePointTypeDef* point = &probe_points[k];
+    // The probe may bounce or be released over the retract, that's ignored.
+    if ( !point->armed || (point->hit != _NotHit) ) continue;
+    if (move == point->descent)
+    {
+      MotorGetSteps(point->steps);
+      for (uint8_t i = 0; i < AXIS_AMOUNT; i++)
+      {
+        MotorHaltAxis((Axis)i);
+      }
+      point->hit = _HitDescent;
+    }
+    else if (move - point->travel < point->descent - point->travel)
+    {
+      // The moves queued ahead are dropped as well.
+      MotorQuickStop();
+      point->hit = _HitTravel;
+    }
+  }
+}
+
+/**
+  * @brief Move all axises towards the end stops by travel until all of them
+  * are hit. Every axis is halted by the IRQ of its end stop, the axises
+  * whose end stops are hit already aren't moved.
+  * Returns _OutOfRange if an end stop isn't hit.
+  */
+static Error ApproachEndStops(double rpm, double travel)
+{
+  Error err = _Success;
+  double rpm_all[AXIS_AMOUNT] = {rpm, rpm, rpm};
+  double angle[AXIS_AMOUNT];
+  end_stops_armed = 0x07;
+  for (uint8_t i = 0; i < AXIS_AMOUNT; i++)
+  {
+    angle[i] = MotorGetAngle((Axis)i) - travel;
+    // The end stop being hit already doesn't give an edge.
+    if (HAL_GPIO_ReadPin(GPIOE, end_stop_pins[i]) == GPIO_PIN_RESET)
+    {
+      taskENTER_CRITICAL();
+      MotorHaltAxis((Axis)i);
+      end_stops_armed &= ~(1 << i);
+      taskEXIT_CRITICAL();
+    }
+  }
+  if (end_stops_armed != 0)
+  {
+    err = MotorQueueMove(rpm_all, angle);
+    if (err != _Success) goto e;
+    // The move is cut as soon as all axises are halted.
+    err = MotorWaitMove(MotorQueueGetLast(), osWaitForever);
+    if (err != _Success) goto e;
+  }
+  // Drop the rest of the move, this releases the halted axises as well.
+  err = MotorStopAll();
+  if (err != _Success) goto e;
+  if (end_stops_armed != 0) err = _OutOfRange;
+  e:
+  end_stops_armed = 0;
+  return err;
+}
+
+/**
+  * @brief Move all axises off the end stops by HOMING_BACK_OFF. The axises
+  * whose end stops are still pressed, e.g. due to the switch hysteresis,
+  * are backed off by the same angle again, so the slow approach starts with
+  * all end stops released.
+  * Returns _OutOfRange if an end stop isn't released.
+  */
+static Error BackOffEndStops(void)
+{
+  Error err = _Success;
+  double rpm[AXIS_AMOUNT] = {HOMING_FAST_RPM, HOMING_FAST_RPM, HOMING_FAST_RPM};
+  double angle[AXIS_AMOUNT];
+  uint8_t pressed = 0x07;
+  for (uint8_t n = 0; (pressed != 0) && (n < HOMING_BACK_OFF_TRIES); n++)
+  {
+    for (uint8_t i = 0; i < AXIS_AMOUNT; i++)
+    {
+      angle[i] = MotorGetAngle((Axis)i) + ((pressed & (1 << i)) ? HOMING_BACK_OFF : 0);
+    }
+    err = MotorQueueMove(rpm, angle);
+    if (err != _Success) return err;
+    err = MotorWaitMove(MotorQueueGetLast(), osWaitForever);
+    if (err != _Success) return err;
+    pressed = 0;
+    for (uint8_t i = 0; i < AXIS_AMOUNT; i++)
+    {
+      if (HAL_GPIO_ReadPin(GPIOE, end_stop_pins[i]) == GPIO_PIN_RESET) pressed |= 1 << i;
+    }
+  }
+  return (pressed != 0) ? _OutOfRange : _Success;
 }
 
 /* Public functions */
@@ -79,6 +416,21 @@ static double GetZAngle(double Z)
 Error InitAllMotors(void)
 {
   InitEndStops();
+  InitProbe();
+  BedMeshLoad();  // There is no mesh until the bed is probed, it's zero then
+  for (uint32_t i = 0; i < MOVE_BUFFER_SIZE; i++)
+  {
+    moves[i].last_block = MotorQueueGetLast();
+    moves[i].err = _Success;
+  }
+  moves_planned = moves_head;
+  moves_prepared = moves_head;
+  if (planner == NULL)
+  {
+    osThreadDef(motionPlanner, PlannerTask, PLANNER_PRIORITY, 0, PLANNER_STACK_SIZE);
+    planner = osThreadCreate(osThread(motionPlanner), NULL);
+    if (planner == NULL) return _HALError;
+  }
   return SMotorDriversInit();
 }
 
@@ -134,47 +486,1077 @@ Error ZeroOutPosition(void)
 
 Error GoToRefer(void)
 {
-  int8_t ready = 0;
-  int32_t x = 0;
-  int32_t y = 0;
-  int32_t z = 0;
-  while(ready != 0x07)
+  // The planner mustn't put moves to the motor queue at the same time.
+  Error err = WaitForMotionEnd();
+  if (err != _Success) goto e;
+  // All axises share the step engine, so they are homed together.
+  err = ApproachEndStops(HOMING_FAST_RPM, HOMING_TRAVEL);
+  if (err != _Success) goto e;
+  err = BackOffEndStops();
+  if (err != _Success) goto e;
+  err = ApproachEndStops(HOMING_SLOW_RPM, (HOMING_BACK_OFF_TRIES + 1)*HOMING_BACK_OFF);
+  if (err != _Success) goto e;
+  return _Success;
+  e:
+  return err;
+}
+
+/**
+  * @brief Get the length of the S-curve ramp between the speeds.
+  * The acceleration of v(x) = low + (high - low)*(3x^2 - 2x^3) peaks below
+  * (high - low)*(1.5*low + high - low)/length, so it doesn't exceed accel.
+  */
+static float GetSCurveLength(float low, float high, float accel)
+{
+  float d = high - low;
+  return d*(1.5f*low + d)/accel;
+}
+
+/**
+  * @brief Get the highest speed the tool can reach from the speed v
+  * (or brake from to the speed v) over the length l
+  */
+static float GetReachableSpeed(float v, float l, float accel, Ramp ramp)
+{
+  if (ramp == _SCurve)
   {
-    if (HAL_GPIO_ReadPin(GPIOE, GPIO_PIN_5) == GPIO_PIN_SET) MotorSetSpeedAndValue(_X, 300, --x); else ready |= (1<<0);
-    if (HAL_GPIO_ReadPin(GPIOE, GPIO_PIN_6) == GPIO_PIN_SET) MotorSetSpeedAndValue(_Y, 300, --y); else ready |= (1<<1);
-    if (HAL_GPIO_ReadPin(GPIOE, GPIO_PIN_7) == GPIO_PIN_SET) MotorSetSpeedAndValue(_Z, 300, --z); else ready |= (1<<2);
-    while(IsMotorBusy(_X));
-    while(IsMotorBusy(_Y));
-    while(IsMotorBusy(_Z));
+    // Solve GetSCurveLength(v, v + d, accel) = l for d.
+    return v + (sqrtf(2.25f*v*v + 4*accel*l) - 1.5f*v)/2;
   }
+  return sqrtf(v*v + 2*accel*l);
+}
+
+/**
+  * @brief Calculate the tool speed profile of a move of length l.
+  * The tool enters the move with entry, accelerates up to speed and
+  * decelerates to exit. If there is not enough room to reach speed, the
+  * highest speed the move can reach is the cruise one. The planner
+  * guarantees the move can be entered with entry and left with exit.
+  */
+static void GetToolProfile(float l, float speed, float accel, Ramp ramp,
+                           float entry, float exit, Motion_ProfileTypeDef* profile)
+{
+  float high = (entry < exit) ? exit : entry;
+  float peak = speed;
+  if (high > peak) high = peak;
+  if (ramp == _SCurve)
+  {
+    if (GetSCurveLength(entry, peak, accel) + GetSCurveLength(exit, peak, accel) > l)
+    {
+      // The length only grows with the peak speed, bisect it.
+      float top = peak;
+      peak = high;
+      for (uint8_t i = 0; i < 20; i++)
+      {
+        float mid = (peak + top)/2;
+        if (GetSCurveLength(entry, mid, accel) + GetSCurveLength(exit, mid, accel) > l) top = mid; else peak = mid;
+      }
+    }
+    profile->accel_l = GetSCurveLength(entry, peak, accel);
+    profile->decel_l = GetSCurveLength(exit, peak, accel);
+  }
+  else
+  {
+    float v_peak = sqrtf(accel*l + (entry*entry + exit*exit)/2);
+    if (v_peak < peak) peak = v_peak;
+    if (peak < high) peak = high;
+    profile->accel_l = (peak*peak - entry*entry)/(2*accel);
+    profile->decel_l = (peak*peak - exit*exit)/(2*accel);
+  }
+  if (profile->accel_l < 0) profile->accel_l = 0;
+  if (profile->decel_l < 0) profile->decel_l = 0;
+  // Keep the ramps within the move despite the rounding errors.
+  float ramps_l = profile->accel_l + profile->decel_l;
+  if (ramps_l > l)
+  {
+    profile->accel_l *= l/ramps_l;
+    profile->decel_l *= l/ramps_l;
+  }
+  profile->ramp = ramp;
+  profile->entry = (entry < peak) ? entry : peak;
+  profile->exit = (exit < peak) ? exit : peak;
+  profile->peak = peak;
+  profile->accel = accel;
+}
+
+/**
+  * @brief Tool speed at the distance s from the start of a move of
+  * length l.
+  * The S-curve speed is low + (high - low)*(3x^2 - 2x^3) over a ramp, x is
+  * the part of the ramp passed, so the acceleration rises from zero and
+  * doesn't exceed accel.
+  */
+static float GetToolSpeed(float s, float l, const Motion_ProfileTypeDef* profile)
+{
+  float v;
+  float x;
+  if (s < profile->accel_l)
+  {
+    v = profile->entry;
+    x = s/profile->accel_l;
+  }
+  else if (l - s < profile->decel_l)
+  {
+    v = profile->exit;
+    x = (l - s)/profile->decel_l;
+  }
+  else
+  {
+    return profile->peak;
+  }
+  if (profile->ramp == _SCurve) return v + (profile->peak - v)*x*x*(3 - 2*x);
+  // v^2 changes linearly over the ramp.
+  return sqrtf(v*v + (profile->peak*profile->peak - v*v)*x);
+}
+
+/**
+  * @brief Start walking along the path of the move
+  */
+static void PathStart(const Motion_MoveTypeDef* move, Motion_PathPointTypeDef* point)
+{
+  point->X = move->from_X;
+  point->Y = move->from_Y;
+  point->Z = move->from_Z;
+  point->r_X = move->from_X - move->c_X;
+  point->r_Y = move->from_Y - move->c_Y;
+  point->i = 0;
+  if (move->path != _Curve) return;
+  // B(t) = (1-t)^3*P0 + 3(1-t)^2*t*P1 + 3(1-t)*t^2*P2 + t^3*P3 at t = 0.
+  float p0[3] = {move->from_X, move->from_Y, move->from_Z};
+  float p3[3] = {move->X, move->Y, move->Z};
+  for (uint8_t j = 0; j < 3; j++)
+  {
+    point->d1[j] = 3*(move->c1[j] - p0[j]);
+    point->d2[j] = 6*(p0[j] - 2*move->c1[j] + move->c2[j]);
+    point->d3[j] = 6*(p3[j] - 3*move->c2[j] + 3*move->c1[j] - p0[j]);
+  }
+  point->t = 0;
+  point->h = 1;
+}
+
+static float Norm(const float v[3])
+{
+  return sqrtf(v[0]*v[0] + v[1]*v[1] + v[2]*v[2]);
+}
+
+/**
+  * @brief Check the chord of the curve from the point by the parameter h
+  * doesn't deviate from the curve by more than CURVE_TOLERANCE and isn't
+  * longer than SEGMENT_LENGTH. The deviation doesn't exceed max|B''|*h^2/8.
+  */
+static uint8_t IsChordFlat(const Motion_PathPointTypeDef* point, float h)
+{
+  float d1 = Norm(point->d1);
+  float d2 = Norm(point->d2);
+  float d3 = Norm(point->d3);
+  if ((d2 + d3*h)*h*h > 8*CURVE_TOLERANCE) return 0;
+  return (d1 + (d2/2 + d3*h/6)*h)*h <= SEGMENT_LENGTH;
+}
+
+/**
+  * @brief Go to the end of the next chord of the curve
+  */
+static void CurveGo(const Motion_MoveTypeDef* move, Motion_PathPointTypeDef* point)
+{
+  float h = point->h;
+  while (!IsChordFlat(point, h) && (h > CURVE_MIN_STEP)) h /= 2;
+  // The chord is doubled only if the point is on the doubled grid, so the
+  // last chord ends at t = 1 exactly.
+  while ( (h < 1 - point->t) && (floorf(point->t/(2*h)) == point->t/(2*h)) &&
+          IsChordFlat(point, 2*h) ) h *= 2;
+  float p[3] = {point->X, point->Y, point->Z};
+  for (uint8_t j = 0; j < 3; j++)
+  {
+    // Taylor series of the cubic are exact.
+    p[j] += (point->d1[j] + (point->d2[j]/2 + point->d3[j]*h/6)*h)*h;
+    point->d1[j] += (point->d2[j] + point->d3[j]*h/2)*h;
+    point->d2[j] += point->d3[j]*h;
+  }
+  point->t += h;
+  point->h = h;
+  point->i++;
+  if (point->t >= 1)
+  {
+    point->t = 1;
+    p[0] = move->X;
+    p[1] = move->Y;
+    p[2] = move->Z;
+  }
+  point->X = p[0];
+  point->Y = p[1];
+  point->Z = p[2];
+}
+
+/**
+  * @brief Go to the point at the part k of the move.
+  * An arc is passed by chords, every call goes to the end of the next one
+  * and k must be i/n then. The radius is rotated without sin and cos.
+  * A curve is passed by chords as well, k is ignored then.
+  */
+static void PathGo(const Motion_MoveTypeDef* move, Motion_PathPointTypeDef* point, float k)
+{
+  if (move->path == _Curve)
+  {
+    CurveGo(move, point);
+    return;
+  }
+  point->Z = move->from_Z + (move->Z - move->from_Z)*k;
+  if (move->path == _Line)
+  {
+    point->X = move->from_X + (move->X - move->from_X)*k;
+    point->Y = move->from_Y + (move->Y - move->from_Y)*k;
+    return;
+  }
+  point->i++;
+  if (point->i == move->n)
+  {
+    point->X = move->X;
+    point->Y = move->Y;
+    return;
+  }
+  if (point->i % ARC_CORRECTION == 0)
+  {
+    float a = move->theta*point->i/move->n;
+    float r_X = move->from_X - move->c_X;
+    float r_Y = move->from_Y - move->c_Y;
+    point->r_X = r_X*cosf(a) - r_Y*sinf(a);
+    point->r_Y = r_X*sinf(a) + r_Y*cosf(a);
+  }
+  else
+  {
+    float r_X = point->r_X;
+    point->r_X = r_X*move->cos_t - point->r_Y*move->sin_t;
+    point->r_Y = r_X*move->sin_t + point->r_Y*move->cos_t;
+  }
+  point->X = move->c_X + point->r_X;
+  point->Y = move->c_Y + point->r_Y;
+}
+
+/**
+  * @brief Get the directions (unit vectors) the move is started and
+  * finished in
+  */
+static void GetMoveDirections(const Motion_MoveTypeDef* move, float u_start[3], float u_end[3])
+{
+  float dz = (move->Z - move->from_Z)/move->l;
+  if (move->path == _Curve)
+  {
+    // The tangents are the first and the last legs of the control polygon
+    // not degenerated to a point.
+    float p0[3] = {move->from_X, move->from_Y, move->from_Z};
+    float p3[3] = {move->X, move->Y, move->Z};
+    const float* start[3] = {move->c1, move->c2, p3};
+    const float* end[3] = {move->c2, move->c1, p0};
+    for (uint8_t i = 0; i < 3; i++)
+    {
+      float u[3] = {start[i][0] - p0[0], start[i][1] - p0[1], start[i][2] - p0[2]};
+      float l = Norm(u);
+      if ( (l == 0) && (i < 2) ) continue;
+      for (uint8_t j = 0; j < 3; j++)
+      {
+        u_start[j] = u[j]/l;
+      }
+      break;
+    }
+    for (uint8_t i = 0; i < 3; i++)
+    {
+      float u[3] = {p3[0] - end[i][0], p3[1] - end[i][1], p3[2] - end[i][2]};
+      float l = Norm(u);
+      if ( (l == 0) && (i < 2) ) continue;
+      for (uint8_t j = 0; j < 3; j++)
+      {
+        u_end[j] = u[j]/l;
+      }
+      break;
+    }
+    return;
+  }
+  if (move->path == _Line)
+  {
+    u_start[0] = (move->X - move->from_X)/move->l;
+    u_start[1] = (move->Y - move->from_Y)/move->l;
+    u_start[2] = dz;
+    for (uint8_t i = 0; i < 3; i++)
+    {
+      u_end[i] = u_start[i];
+    }
+    return;
+  }
+  // The tangent is the radius turned by 90 grads, scaled by the horizontal
+  // part of the speed.
+  float r_X = move->from_X - move->c_X;
+  float r_Y = move->from_Y - move->c_Y;
+  float h = move->theta/move->l;
+  u_start[0] = -r_Y*h;
+  u_start[1] = r_X*h;
+  u_start[2] = dz;
+  r_X = move->X - move->c_X;
+  r_Y = move->Y - move->c_Y;
+  u_end[0] = -r_Y*h;
+  u_end[1] = r_X*h;
+  u_end[2] = dz;
+}
+
+/**
+  * @brief Get the max motor speed (grads/s) per the tool speed (mm/s) over
+  * the move. The Jacobian is checked at the middle of every segment.
+  */
+static Error GetMaxJointRate(Motion_MoveTypeDef* move, uint32_t n, float *rate)
+{
+  float J[AXIS_AMOUNT][AXIS_AMOUNT];
+  Motion_PathPointTypeDef point;
+  PathStart(move, &point);
+  *rate = 0;
+  for (uint32_t i = 1; i <= n; i++)
+  {
+    float d[AXIS_AMOUNT] = {point.X, point.Y, point.Z};
+    PathGo(move, &point, (float)i/n);
+    d[_X] = point.X - d[_X];
+    d[_Y] = point.Y - d[_Y];
+    d[_Z] = point.Z - d[_Z];
+    float l = sqrtf(d[_X]*d[_X] + d[_Y]*d[_Y] + d[_Z]*d[_Z]);
+    if (l == 0) continue;
+    Error err = KinGetJacobian(point.X - d[_X]/2, point.Y - d[_Y]/2, point.Z - d[_Z]/2, J);
+    if (err != _Success) return err;
+    for (uint8_t j = 0; j < AXIS_AMOUNT; j++)
+    {
+      float w = fabsf(J[j][_X]*d[_X] + J[j][_Y]*d[_Y] + J[j][_Z]*d[_Z])/l;
+      if (w > *rate) *rate = w;
+    }
+  }
+  return _Success;
+}
+
+/**
+  * @brief Get the length of the move, the number of its segments and its
+  * speed and acceleration limits
+  */
+static Error LimitMove(Motion_MoveTypeDef* move)
+{
+  float d[3] = {move->X - move->from_X, move->Y - move->from_Y, move->Z - move->from_Z};
+  move->l = sqrtf(d[0]*d[0] + d[1]*d[1] + d[2]*d[2]);
+  move->accel = MOTION_ACCEL;
+  if (move->path == _Arc)
+  {
+    float r_X = move->from_X - move->c_X;
+    float r_Y = move->from_Y - move->c_Y;
+    float r = sqrtf(r_X*r_X + r_Y*r_Y);
+    float arc_l = r*fabsf(move->theta);
+    move->l = sqrtf(arc_l*arc_l + d[2]*d[2]);
+    // The chord of the angle a deviates from the arc by r*(1 - cos(a/2)).
+    float chord_a = (r > ARC_TOLERANCE) ? 2*acosf(1 - ARC_TOLERANCE/r) : PI_F;
+    move->n = (uint32_t)ceilf(fabsf(move->theta)/chord_a);
+    uint32_t n = (uint32_t)ceilf(move->l/SEGMENT_LENGTH);
+    if (n > move->n) move->n = n;
+    move->cos_t = cosf(move->theta/move->n);
+    move->sin_t = sinf(move->theta/move->n);
+  }
+  if (move->path == _Curve)
+  {
+    // The chords are only known by walking the curve.
+    Motion_PathPointTypeDef point;
+    PathStart(move, &point);
+    move->l = 0;
+    move->n = 0;
+    while (point.t < 1)
+    {
+      float p[3] = {point.X, point.Y, point.Z};
+      CurveGo(move, &point);
+      p[0] -= point.X;
+      p[1] -= point.Y;
+      p[2] -= point.Z;
+      move->l += Norm(p);
+      move->n++;
+    }
+  }
+  if (move->l == 0) return _Success;
+  if (move->path == _Line) move->n = (uint32_t)ceilf(move->l/SEGMENT_LENGTH);
+  float rate;
+  Error err = GetMaxJointRate(move, move->n, &rate);
+  if (err != _Success) return err;
+  // 6 grads/s = 1 rpm.
+  if (rate*move->speed > MOTION_MAX_RPM*6) move->speed = MOTION_MAX_RPM*6/rate;
+  if (rate*move->accel > MOTION_MAX_ACCEL*6) move->accel = MOTION_MAX_ACCEL*6/rate;
+  return _Success;
+}
+
+/**
+  * @brief Prepare the move for planning: get its limits and the max speed
+  * of the junction with the previous move. The junction speed is the one
+  * of the circular path deviating from the corner by
+  * MOTION_JUNCTION_DEVIATION, with the centripetal acceleration of the moves.
+  */
+static void PrepareMove(Motion_MoveTypeDef* move)
+{
+  move->max_entry = 0;
+  move->err = LimitMove(move);
+  if (move->err != _Success)
+  {
+    // The move is dropped, the tool stops before it.
+    move->l = 0;
+    last_speed = 0;
+    return;
+  }
+  if (move->l == 0)
+  {
+    // Nothing to do, the speed is passed to the next move.
+    move->max_entry = last_speed;
+    move->speed = last_speed;
+    move->accel = last_accel;
+    return;
+  }
+  float u[3];
+  float u_end[3];
+  GetMoveDirections(move, u, u_end);
+  // cos of the angle between the moves, -1 is a straight line.
+  float cos_a = -(u[0]*last_u[0] + u[1]*last_u[1] + u[2]*last_u[2]);
+  float junction = (move->speed < last_speed) ? move->speed : last_speed;
+  if (cos_a > -0.999999f)
+  {
+    float accel = (move->accel < last_accel) ? move->accel : last_accel;
+    float sin_a2 = sqrtf((1 - cos_a)/2);   // sin of the half angle
+    float v = (sin_a2 < 0.999999f) ? sqrtf(accel*MOTION_JUNCTION_DEVIATION*sin_a2/(1 - sin_a2)) : 0;
+    if (v < junction) junction = v;
+  }
+  move->max_entry = junction;
+  for (uint8_t i = 0; i < 3; i++)
+  {
+    last_u[i] = u_end[i];
+  }
+  last_speed = move->speed;
+  last_accel = move->accel;
+}
+
+/**
+  * @brief Plan the entry speeds of the moves buffered.
+  * The backward pass starts from the last move, which must stop, and lowers
+  * the entry speeds to the ones the tool can brake from in time. The
+  * forward pass starts from the move being planned, which is entered with
+  * the exit speed of the previous one, and lowers the entry speeds to the
+  * ones the tool can accelerate to in time. So the tool decelerates only
+  * where the corners or the end of the buffer require it.
+  */
+static void PlanSpeeds(void)
+{
+  float v = 0;
+  for (uint32_t i = moves_prepared - 1; i != moves_planned; i--)
+  {
+    Motion_MoveTypeDef* move = &moves[i & (MOVE_BUFFER_SIZE - 1)];
+    move->entry = GetReachableSpeed(v, move->l, move->accel, move->ramp);
+    if (move->entry > move->max_entry) move->entry = move->max_entry;
+    v = move->entry;
+  }
+  moves[moves_planned & (MOVE_BUFFER_SIZE - 1)].entry = planned_exit;
+  v = planned_exit;
+  for (uint32_t i = moves_planned; i + 1 != moves_prepared; i++)
+  {
+    Motion_MoveTypeDef* move = &moves[i & (MOVE_BUFFER_SIZE - 1)];
+    Motion_MoveTypeDef* next = &moves[(i + 1) & (MOVE_BUFFER_SIZE - 1)];
+    float exit = GetReachableSpeed(v, move->l, move->accel, move->ramp);
+    if (next->entry > exit) next->entry = exit;
+    v = next->entry;
+  }
+}
+
+/**
+  * @brief Split the move into segments and put them to the motor queue.
+  * The tool moves along the straight line, since the kinematics is solved
+  * for every segment. The joint speeds of a segment are the ones giving
+  * the planned tool speed, so the tool speed follows the trapezoidal or the
+  * S-curve profile over the whole move and the segments are joined without
+  * stopping. The move is entered with its planned entry speed and left with
+  * exit.
+  * The speed and the acceleration are limited by the Jacobian of the
+  * kinematics, so the motors don't exceed their limits.
+  */
+static Error PlanMove(Motion_MoveTypeDef* move, float exit)
+{
+  if (move->err != _Success) return move->err;
+  if (move->l == 0) return _Success;  // We don't need to move
+  float l = move->l;
+  uint32_t n = move->n;
+  Motion_ProfileTypeDef profile;
+  GetToolProfile(l, move->speed, move->accel, move->ramp, move->entry, exit, &profile);
+
+  float angle[AXIS_AMOUNT];
+  int32_t from[AXIS_AMOUNT];
+  int32_t to[AXIS_AMOUNT];
+  float mesh_z = move->mesh ? BedMeshGetZ(move->from_X, move->from_Y) : 0;
+  Error err = KinLookUpAngles(move->from_X, move->from_Y, move->from_Z + mesh_z, angle);
+  if (err != _Success) return err;
+  for (uint8_t j = 0; j < AXIS_AMOUNT; j++)
+  {
+    from[j] = MotorAngleToSteps(angle[j]);
+  }
+  Motion_PathPointTypeDef point;
+  PathStart(move, &point);
+  float c0[3];          // Start of the chord of the path
+  float c[3];           // Chord of the path
+  float c_l = 0;        // Length of the chord
+  float t = 1;          // Part of the chord passed
+  float s1 = 0;
+  uint32_t i = 0;
+  while ( (i < n) || (t < 1) )
+  {
+    if (t >= 1)
+    {
+      c0[0] = point.X;
+      c0[1] = point.Y;
+      c0[2] = point.Z;
+      i++;
+      PathGo(move, &point, (float)i/n);
+      c[0] = point.X - c0[0];
+      c[1] = point.Y - c0[1];
+      c[2] = point.Z - c0[2];
+      c_l = Norm(c);
+      if (c_l == 0) continue;
+      t = 0;
+    }
+    // The height bends at the mesh cell boundaries, so the chords of any
+    // path crossing them are split there.
+    float t0 = t;
+    t = 1;
+    if (move->mesh)
+    {
+      float split = BED_MESH_MIN_SPLIT/c_l;
+      float boundary = BedMeshNextBoundary(c0[0], c0[1], c[0], c[1], t0 + split);
+      if (boundary < 1 - split) t = boundary;
+    }
+    float p[3] = {point.X, point.Y, point.Z};
+    if (t < 1)
+    {
+      for (uint8_t j = 0; j < 3; j++)
+      {
+        p[j] = c0[j] + c[j]*t;
+      }
+    }
+    if (move->mesh) mesh_z = BedMeshGetZ(p[0], p[1]);
+    err = KinLookUpAngles(p[0], p[1], p[2] + mesh_z, angle);
+    if (err != _Success) return err;
+
+    float s0 = s1;
+    float seg = c_l*(t - t0);
+    s1 = ( (i == n) && (t == 1) ) ? l : s0 + seg;
+    float v_entry = GetToolSpeed(s0, l, &profile);
+    float v_exit = GetToolSpeed(s1, l, &profile);
+    float v = (v_entry > v_exit) ? v_entry : v_exit;
+    if ( (s0 <= l - profile.decel_l) && (s1 >= profile.accel_l) ) v = profile.peak;
+
+    // The step rate of the fastest axis, so the segment takes seg/v seconds.
+    uint32_t steps = 0;
+    for (uint8_t j = 0; j < AXIS_AMOUNT; j++)
+    {
+      to[j] = MotorAngleToSteps(angle[j]);
+      uint32_t delta = (to[j] > from[j]) ? to[j] - from[j] : from[j] - to[j];
+      if (delta > steps) steps = delta;
+      from[j] = to[j];
+    }
+    float rate = steps*v/seg*(1 << MOTOR_RATE_SHIFT);
+    if (motion_stopping) return _Aborted;  // The rest of the move is dropped
+    err = MotorQueueWaitFree(osWaitForever);
+    if (err != _Success) return err;
+    err = MotorQueueMoveRate(to, (uint32_t)rate, (uint32_t)(rate*v_entry/v), (uint32_t)(rate*v_exit/v));
+    if (err != _Success) return err;
+  }
+  return _Success;
+}
+
+/**
+  * @brief Drop the buffered moves, they are finished with _Aborted along
+  * with the motor queue move being stopped. The tool is at rest after them.
+  */
+static void DropMoves(void)
+{
+  uint32_t head = moves_head;
+  for (uint32_t i = moves_planned; i != head; i++)
+  {
+    Motion_MoveTypeDef* move = &moves[i & (MOVE_BUFFER_SIZE - 1)];
+    move->err = _Aborted;
+    move->last_block = MotorQueueGetLast();
+  }
+  moves_prepared = head;
+  moves_planned = head;
+  last_speed = 0;
+  planned_exit = 0;
+  moves_dropped = 1;
+}
+
+/**
+  * @brief Check the buffered move is planned, its motor queue moves are known
+  */
+static uint8_t IsMovePlanned(uint32_t move)
+{
+  return (int32_t)(moves_planned - move) > 0;
+}
+
+/**
+  * @brief Wake up the tasks waiting for the moves planned
+  */
+static void NotifyWaiters(void)
+{
+  taskENTER_CRITICAL();
+  for (uint8_t i = 0; i < MOTION_WAITERS; i++)
+  {
+    osThreadId waiter = moves_waiters[i].thread;
+    if ( (waiter != NULL) && IsMovePlanned(moves_waiters[i].move) )
+    {
+      moves_waiters[i].thread = NULL;
+      osSignalSet(waiter, MOTION_SIGNAL);
+    }
+  }
+  taskEXIT_CRITICAL();
+}
+
+/**
+  * @brief Get the time left to wait from start, in ms
+  */
+static uint32_t TimeLeft(uint32_t start, uint32_t millisec)
+{
+  if (millisec == osWaitForever) return millisec;
+  uint32_t spent = (uint64_t)(osKernelSysTick() - start) * 1000 / osKernelSysTickFrequency;
+  return (spent < millisec) ? millisec - spent : 0;
+}
+
+/**
+  * @brief Wait until the buffered move is planned, the calling task is
+  * blocked and woken up by the planner. start is the tick the wait began at.
+  * Returns _Timeout if the move isn't planned in millisec and _QueueFull
+  * if there are too many tasks waiting.
+  */
+static Error WaitPlanned(uint32_t move, uint32_t start, uint32_t millisec)
+{
+  if (IsMovePlanned(move)) return _Success;
+  // Take a free waiter entry, the planner frees the entries too.
+  Motion_WaiterTypeDef* waiter = NULL;
+  osThreadId thread = osThreadGetId();
+  taskENTER_CRITICAL();
+  for (uint8_t i = 0; i < MOTION_WAITERS; i++)
+  {
+    if (moves_waiters[i].thread == NULL)
+    {
+      waiter = &moves_waiters[i];
+      waiter->move = move;
+      waiter->thread = thread;
+      break;
+    }
+  }
+  taskEXIT_CRITICAL();
+  if (waiter == NULL) return _QueueFull;
+
+  // A signal left from the previous wait just makes one more iteration.
+  Error err = _Success;
+  while (!IsMovePlanned(move))
+  {
+    uint32_t left = TimeLeft(start, millisec);
+    if ( (left == 0) || (osSignalWait(MOTION_SIGNAL, left).status == osEventTimeout) )
+    {
+      err = _Timeout;
+      break;
+    }
+  }
+  taskENTER_CRITICAL();
+  if (waiter->thread == thread) waiter->thread = NULL;
+  taskEXIT_CRITICAL();
+  return err;
+}
+
+static void PlannerTask(void const *argument)
+{
+  (void)argument;
+  for (;;)
+  {
+    osThreadId stopping = motion_stopping;
+    if (stopping != NULL)
+    {
+      DropMoves();
+      NotifyWaiters();
+      osSignalSet(stopping, MOTION_SIGNAL);
+      osSignalWait(PLANNER_SIGNAL, osWaitForever);
+      continue;
+    }
+    while (moves_prepared != moves_head)
+    {
+      PrepareMove(&moves[moves_prepared & (MOVE_BUFFER_SIZE - 1)]);
+      moves_prepared++;
+    }
+    if (moves_planned == moves_head)
+    {
+      osSignalWait(PLANNER_SIGNAL, osWaitForever);
+      continue;
+    }
+    if ( (moves_prepared - moves_planned == 1) &&
+         !IsMotorMoveDone(MotorQueueGetLast() - PLANNER_LOW_BLOCKS) &&
+         (MotorSignalMove(MotorQueueGetLast() - PLANNER_LOW_BLOCKS, PLANNER_SIGNAL) == _Success) )
+    {
+      // The motors are busy, wait for the next move to join this one with.
+      osSignalWait(PLANNER_SIGNAL, osWaitForever);
+      MotorCancelSignal();
+      continue;
+    }
+    PlanSpeeds();
+    Motion_MoveTypeDef* move = &moves[moves_planned & (MOVE_BUFFER_SIZE - 1)];
+    float exit = 0;
+    if (moves_prepared - moves_planned > 1) exit = moves[(moves_planned + 1) & (MOVE_BUFFER_SIZE - 1)].entry;
+    move->err = PlanMove(move, exit);
+    planned_exit = (move->err == _Success) ? exit : 0;
+    move->last_block = MotorQueueGetLast();
+    moves_planned++;
+    NotifyWaiters();
+  }
+}
+
+/**
+  * @brief Put the straight move between the points to the motor queue
+  * bypassing the move buffer, the move is started and finished with zero
+  * speed. If split is 0, the move is put as one motor queue move, and the
+  * kinematics bends its path slightly. The planner must be idle.
+  */
+static Error QueueLine(const float from[3], const float to[3], float speed, uint8_t split)
+{
+  Motion_MoveTypeDef move;
+  move.from_X = from[0];
+  move.from_Y = from[1];
+  move.from_Z = from[2];
+  move.X = to[0];
+  move.Y = to[1];
+  move.Z = to[2];
+  move.speed = speed;
+  move.path = _Line;
+  move.ramp = motion_ramp;
+  move.mesh = 0;
+  move.entry = 0;
+  move.err = LimitMove(&move);
+  if (!split) move.n = 1;
+  return PlanMove(&move, 0);
+}
+
+/**
+  * @brief Find the tool by the angles of the motors, after they have been
+  * stopped off the planned path. curr_X, curr_Y and curr_Z are the guess.
+  */
+static Error FindPosition(uint8_t mesh)
+{
+  double angle[AXIS_AMOUNT];
+  for (uint8_t i = 0; i < AXIS_AMOUNT; i++)
+  {
+    angle[i] = MotorGetAngle((Axis)i);
+  }
+  double point[3] = {curr_X, curr_Y, curr_Z};
+  Error err = KinGetPoint(angle, point);
+  if (err != _Success) return err;
+  if (mesh) point[2] -= BedMeshGetZ(point[0], point[1]);
+  curr_X = point[0];
+  curr_Y = point[1];
+  curr_Z = point[2];
+  return _Success;
+}
+
+/**
+  * @brief Queue the travel to the point, the descent over it and the
+  * retract. pos is the point the tool is at after the moves queued before,
+  * it's set to the one after the retract.
+  */
+static Error QueuePoint(const Motion_ProbeGridTypeDef* grid, Motion_ProbePointTypeDef* point, float pos[3])
+{
+  Error err = _Success;
+  float over[3] = {point->X, point->Y, grid->Z_start};
+  float down[3] = {point->X, point->Y, grid->Z_end};
+  point->armed = 0;
+  point->hit = _NotHit;
+  point->travel = MotorQueueGetLast() + 1;
+  err = QueueLine(pos, over, PROBE_TRAVEL_SPEED, 1);
+  if (err != _Success) return err;
+  point->descent = MotorQueueGetLast() + 1;
+  point->armed = 1;
+  // The descent is one motor queue move, so the probe halt ends all of it.
+  err = QueueLine(over, down, grid->speed, 0);
+  if (err != _Success) return err;
+  // The retract makes up the steps of the descent dropped by the halt.
+  err = QueueLine(down, over, PROBE_TRAVEL_SPEED, 1);
+  if (err != _Success) return err;
+  pos[0] = over[0];
+  pos[1] = over[1];
+  pos[2] = over[2];
+  return _Success;
+}
+
+Error ProbeGrid(const Motion_ProbeGridTypeDef* grid, float* Z)
+{
+  if ( (grid->nX == 0) || (grid->nY == 0) || (grid->speed <= 0) ) return _OutOfRange;
+  if (grid->Z_end >= grid->Z_start) return _OutOfRange;
+  // The planner mustn't put moves to the motor queue at the same time.
+  Error err = WaitForMotionEnd();
+  if (err != _Success) return err;
+  uint32_t n = grid->nX*grid->nY;
+  uint32_t queued = 0;
+  float pos[3] = {curr_X, curr_Y, curr_Z};
+  if (pos[2] < grid->Z_start)
+  {
+    float up[3] = {pos[0], pos[1], grid->Z_start};
+    err = QueueLine(pos, up, PROBE_TRAVEL_SPEED, 1);
+    if (err != _Success) goto e;
+    pos[2] = grid->Z_start;
+  }
+  for (uint32_t k = 0; k < n; k++)
+  {
+    // The moves of the next points are queued while this one is probed.
+    for (; (queued < n) && (queued - k < PROBE_AHEAD); queued++)
+    {
+      Motion_ProbePointTypeDef* point = &probe_points[queued & (PROBE_AHEAD - 1)];
+      // The rows are passed back and forth to shorten the travel.
+      uint32_t j = queued/grid->nX;
+      uint32_t i = (j & 1) ? grid->nX - 1 - queued % grid->nX : queued % grid->nX;
+      point->X = grid->X0 + i*grid->dX;
+      point->Y = grid->Y0 + j*grid->dY;
+      point->index = j*grid->nX + i;
+      err = QueuePoint(grid, point, pos);
+      if (err != _Success) goto e;
+    }
+    Motion_ProbePointTypeDef* point = &probe_points[k & (PROBE_AHEAD - 1)];
+    err = MotorWaitMove(point->descent, osWaitForever);
+    if (err != _Success) goto e;
+    if (point->hit != _HitDescent)
+    {
+      err = _OutOfRange;
+      goto e;
+    }
+    point->armed = 0;
+    double angle[AXIS_AMOUNT];
+    for (uint8_t i = 0; i < AXIS_AMOUNT; i++)
+    {
+      angle[i] = MotorStepsToAngle(point->steps[i]);
+    }
+    double probed[3] = {point->X, point->Y, grid->Z_end};
+    err = KinGetPoint(angle, probed);
+    if (err != _Success) goto e;
+    Z[point->index] = (float)probed[2];
+  }
+  err = MotorWaitMove(MotorQueueGetLast(), osWaitForever);
+  if (err != _Success) goto e;
+  curr_X = pos[0];
+  curr_Y = pos[1];
+  curr_Z = pos[2];
+  return _Success;
+  e:
+  for (uint8_t k = 0; k < PROBE_AHEAD; k++)
+  {
+    probe_points[k].armed = 0;
+  }
+  // The moves queued ahead are dropped, the tool is found by the motors.
+  MotorStopAll();
+  curr_X = pos[0];
+  curr_Y = pos[1];
+  curr_Z = pos[2];
+  FindPosition(0);
+  return err;
+}
+
+/**
+  * @brief Get the free entry of the move buffer for the move from the
+  * current point to the specified one and fill it as a straight move.
+  * Returns NULL if the buffer is full.
+  */
+static Motion_MoveTypeDef* NewMove(double X, double Y, double Z, double speed)
+{
+  if (moves_head - moves_planned == MOVE_BUFFER_SIZE) return NULL;
+  Motion_MoveTypeDef* move = &moves[moves_head & (MOVE_BUFFER_SIZE - 1)];
+  move->from_X = curr_X;
+  move->from_Y = curr_Y;
+  move->from_Z = curr_Z;
+  move->X = X;
+  move->Y = Y;
+  move->Z = Z;
+  move->path = _Line;
+  move->speed = speed;
+  move->ramp = motion_ramp;
+  move->mesh = motion_mesh;
+  return move;
+}
+
+/**
+  * @brief Pass the move got by NewMove() to the planner
+  */
+static void PutMove(const Motion_MoveTypeDef* move, MoveHandle* handle)
+{
+  if (handle != NULL) *handle = moves_head;
+  moves_head++;
+  osSignalSet(planner, PLANNER_SIGNAL);
+
+  curr_X = move->X;
+  curr_Y = move->Y;
+  curr_Z = move->Z;
+}
+
+/**
+  * @brief Check the point can be reached
+  */
+static Error CheckPoint(double X, double Y, double Z)
+{
+  float angle[AXIS_AMOUNT];
+  float mesh_z = motion_mesh ? BedMeshGetZ(X, Y) : 0;
+  return KinLookUpAngles(X, Y, Z + mesh_z, angle);
+}
+
+Error GoToWithSpeedAsync(double X, double Y, double Z, double speed, MoveHandle* handle)
+{
+  if (motion_stopping) return _Aborted;
+  if (speed <= 0) return _OutOfRange;
+  Error err = CheckPoint(X, Y, Z);
+  if (err != _Success) return err;
+  Motion_MoveTypeDef* move = NewMove(X, Y, Z, speed);
+  if (move == NULL) return _QueueFull;
+  PutMove(move, handle);
+  return _Success;
+}
+
+Error GoToArcWithSpeedAsync(double X, double Y, double Z, double I, double J,
+                            uint8_t clockwise, double speed, MoveHandle* handle)
+{
+  if (motion_stopping) return _Aborted;
+  if (speed <= 0) return _OutOfRange;
+  float a_X = -I, a_Y = -J;                        // Radius of the start point
+  float b_X = X - (curr_X + I), b_Y = Y - (curr_Y + J);  // Radius of the end point
+  float r = sqrtf(a_X*a_X + a_Y*a_Y);
+  if ( (r == 0) || !(fabsf(sqrtf(b_X*b_X + b_Y*b_Y) - r) <= ARC_RADIUS_TOLERANCE) ) return _OutOfRange;
+  Error err = CheckPoint(X, Y, Z);
+  if (err != _Success) return err;
+  Motion_MoveTypeDef* move = NewMove(X, Y, Z, speed);
+  if (move == NULL) return _QueueFull;
+
+  float theta = atan2f(a_X*b_Y - a_Y*b_X, a_X*b_X + a_Y*b_Y);
+  // The end point equal to the start one is the full circle.
+  if (clockwise && (theta >= 0)) theta -= 2*PI_F;
+  if (!clockwise && (theta <= 0)) theta += 2*PI_F;
+  move->path = _Arc;
+  move->c_X = curr_X + I;
+  move->c_Y = curr_Y + J;
+  move->theta = theta;
+  PutMove(move, handle);
+  return _Success;
+}
+
+Error GoToCurveWithSpeedAsync(double X1, double Y1, double Z1, double X2, double Y2, double Z2,
+                              double X, double Y, double Z, double speed, MoveHandle* handle)
+{
+  if (motion_stopping) return _Aborted;
+  if (speed <= 0) return _OutOfRange;
+  Error err = CheckPoint(X, Y, Z);
+  if (err != _Success) return err;
+  Motion_MoveTypeDef* move = NewMove(X, Y, Z, speed);
+  if (move == NULL) return _QueueFull;
+  move->path = _Curve;
+  move->c1[0] = X1;
+  move->c1[1] = Y1;
+  move->c1[2] = Z1;
+  move->c2[0] = X2;
+  move->c2[1] = Y2;
+  move->c2[2] = Z2;
+  PutMove(move, handle);
+  return _Success;
+}
+
+Error SetMotionRamp(Ramp ramp)
+{
+  if ( (ramp != _Trapezoidal) && (ramp != _SCurve) ) return _OutOfRange;
+  motion_ramp = ramp;
+  return _Success;
+}
+
+Error SetMotionMesh(uint8_t enable)
+{
+  motion_mesh = (enable != 0);
   return _Success;
 }
 
-double XX, YY, ZZ;
 Error GoToWithSpeed(double X, double Y, double Z, double speed)
 {
-  double l = sqrt((X-curr_X)*(X-curr_X)+(Y-curr_Y)*(Y-curr_Y)+(Z-curr_Z)*(Z-curr_Z));
-  double cos_a = (X-curr_X)/l;
-  double cos_b = (Y-curr_Y)/l;
-  double cos_c = (Z-curr_Z)/l;
+  Error err = GoToWithSpeedAsync(X, Y, Z, speed, NULL);
+  while (err == _QueueFull)
+  {
+    // The buffer gets room as soon as the oldest move is planned.
+    err = WaitPlanned(moves_head - MOVE_BUFFER_SIZE, osKernelSysTick(), osWaitForever);
+    if (err != _Success) return err;
+    err = GoToWithSpeedAsync(X, Y, Z, speed, NULL);
+  }
+  return err;
+}
 
-  XX = GetXAngle(X,Y,Z);
-  YY = GetYAngle(X,Y,Z);
-  ZZ = GetZAngle(Z);
+Error GoToArcWithSpeed(double X, double Y, double Z, double I, double J,
+                       uint8_t clockwise, double speed)
+{
+  Error err = GoToArcWithSpeedAsync(X, Y, Z, I, J, clockwise, speed, NULL);
+  while (err == _QueueFull)
+  {
+    err = WaitPlanned(moves_head - MOVE_BUFFER_SIZE, osKernelSysTick(), osWaitForever);
+    if (err != _Success) return err;
+    err = GoToArcWithSpeedAsync(X, Y, Z, I, J, clockwise, speed, NULL);
+  }
+  return err;
+}
+
+Error GoToCurveWithSpeed(double X1, double Y1, double Z1, double X2, double Y2, double Z2,
+                         double X, double Y, double Z, double speed)
+{
+  Error err = GoToCurveWithSpeedAsync(X1, Y1, Z1, X2, Y2, Z2, X, Y, Z, speed, NULL);
+  while (err == _QueueFull)
+  {
+    err = WaitPlanned(moves_head - MOVE_BUFFER_SIZE, osKernelSysTick(), osWaitForever);
+    if (err != _Success) return err;
+    err = GoToCurveWithSpeedAsync(X1, Y1, Z1, X2, Y2, Z2, X, Y, Z, speed, NULL);
+  }
+  return err;
+}
+
+uint8_t IsMoveDone(MoveHandle handle)
+{
+  if (!IsMovePlanned(handle)) return 0;
+  return IsMotorMoveDone(moves[handle & (MOVE_BUFFER_SIZE - 1)].last_block);
+}
+
+Error WaitForMove(MoveHandle handle, uint32_t millisec)
+{
+  uint32_t start = osKernelSysTick();
+  Error err = WaitPlanned(handle, start, millisec);
+  if (err != _Success) return err;
+  Motion_MoveTypeDef* move = &moves[handle & (MOVE_BUFFER_SIZE - 1)];
+  err = MotorWaitMove(move->last_block, TimeLeft(start, millisec));
+  if (err != _Success) return err;
+  return move->err;
+}
+
+Error WaitForMotionEnd(void)
+{
+  return WaitForMove(moves_head - 1, osWaitForever);
+}
 
+Error QuickStopMotion(void)
+{
   Error err = _Success;
-  err = MotorSetSpeedAndValue(_X, speed*cos_a/Kx, GetXAngle(X,Y,Z));
+  moves_dropped = 0;
+  motion_stopping = osThreadGetId();
+  err = MotorQuickStop();
   if (err != _Success) goto e;
-  err = MotorSetSpeedAndValue(_Y, speed*cos_b/Ky, GetYAngle(X,Y,Z));
+  // The planner finishes the move being planned and signals the rest dropped.
+  osSignalSet(planner, PLANNER_SIGNAL);
+  while (!moves_dropped)
+  {
+    osSignalWait(MOTION_SIGNAL, osWaitForever);
+  }
+  // A segment may have been queued after the motors stopped, but before
+  // the planner saw the stop.
+  if (!IsMotorStopping()) err = MotorQuickStop();
   if (err != _Success) goto e;
-  err = MotorSetSpeedAndValue(_Z, speed*cos_c/Kz, GetZAngle(Z));
+  while (IsMotorQueueBusy())
+  {
+    err = MotorQueueWaitNext(osWaitForever);
+    if (err != _Success) goto e;
+  }
+  // The motors are off the planned path, the tool is found by them.
+  err = FindPosition(motion_mesh);
   if (err != _Success) goto e;
-
-  while(IsMotorBusy(_X));
-  while(IsMotorBusy(_Y));
-  while(IsMotorBusy(_Z));
-
+  motion_stopping = NULL;
   return _Success;
   e:
+  motion_stopping = NULL;
   return err;
 }
@@ -9,227 +9,1698 @@
   */
 
 #include "stm32f4xx_hal.h"
+#include "cmsis_os.h"
 #include "stepMotor.h"
 
+#include "math.h"
+
 #define TIM_CLK 168          // Specifies the driver's timers clock, MHz
-/** Specifies the rpm value when we have to increase the timer prescaler.
-  * The value should be calculated considering the rpm point of the minimum
-  * posible rotation speed with the prescaler = 1 according to the following
-  * expression (rounded up to the next integer):
-  * Vmin = TIM_CLK*10^6*MOTOR_STEP_DG/(65535*6*MOTOR_STEP_DIV)
+/** Specifies the step engine's timer prescaler. The longer step periods
+  * than the timer can count are split into several slots.
   */
-#define RPM_PRSC_POINT 49
+#define TIM_PRSC 0
+#define TIM_FRQ  (TIM_CLK*1000000/(TIM_PRSC + 1))  // Step engine's timer frequency, Hz
+#define TIM_MAX_PERIOD 0x10000  // Specifies the longest timer period, ticks
 #define MOTOR_STEP_DIV 16   // Specifies the motors step division value
 #define MOTOR_STEP_DG 1.8   // Specifies the motor step, grad
 
-#define ANGLE_IRQ_PR_PRIORITY  1   // Specifies the preempt priority for TIM IRQ
-#define ANGLE_IRQ_SUB_PRIORITY 0   // Specifies the sub priority for TIM IRQ
+#define MOTOR_ACCEL     600  // Specifies the motors acceleration, rpm/s
+#define MOTOR_START_RPM 30   // Specifies the speed to start and stop a motor without ramping, rpm
+#define MOTOR_MAX_RPM   600  // Specifies the speed the feed rate override doesn't take a motor beyond, rpm
+
+/** The values above converted to step rates, so the profiles are
+  * calculated with integers only. Rates have MOTOR_RATE_SHIFT fractional bits.
+  */
+#define RATE_PER_RPM     (6*MOTOR_STEP_DIV/MOTOR_STEP_DG*(1 << MOTOR_RATE_SHIFT))
+#define MOTOR_START_RATE ((uint32_t)(MOTOR_START_RPM*RATE_PER_RPM))
+#define MOTOR_MAX_RATE   ((uint32_t)(MOTOR_MAX_RPM*RATE_PER_RPM))
+#define MOTOR_ACCEL_STEPS ((uint32_t)(MOTOR_ACCEL*6*MOTOR_STEP_DIV/MOTOR_STEP_DG))  // steps/s^2
+
+#define MOTOR_PULSE_WIDTH 2    // Specifies the step pulse width, us
+#define MOTOR_DIR_SETUP   5    // Specifies the time between a direction change and the next step, us
+#define MOTOR_IDLE_PERIOD 100  // Specifies the slot period when there is nothing to step, us
+
+/** Specifies the number of slots in the period table streamed by DMA,
+  * must be a power of 2. The table is refilled by halves, so a half
+  * must last longer than the refill.
+  */
+#define MOTOR_SLOTS 64
+#define MOTOR_PORTS 2   // Specifies the max number of ports of the step and direction outputs
+
+/** The refill IRQ must calculate a half of the table before DMA is
+  * through the other one, so it has the highest priority of the drivers.
+  */
+#define REFILL_IRQ_PR_PRIORITY  1
+#define REFILL_IRQ_SUB_PRIORITY 0
+
+#define MOTOR_TIM     TIM8
+#define MOTOR_DMA     DMA2_Stream1  // TIM8_UP request
+#define MOTOR_DMA_CH  DMA_CHANNEL_7 // Channel of all TIM8 requests
+#define MOTOR_DMA_IRQ DMA2_Stream1_IRQn
+
+/** The refill IRQ priority is too high to call the RTOS, so it wakes up
+  * the waiting task through a software triggered IRQ of a lower priority.
+  */
+#define NOTIFY_IRQ             TIM1_TRG_COM_TIM11_IRQn
+#define NOTIFY_IRQ_PR_PRIORITY 5   // Must not be higher than configLIBRARY_MAX_SYSCALL_INTERRUPT_PRIORITY
+#define NOTIFY_IRQ_SUB_PRIORITY 0
+#define MOTOR_SIGNAL           0x01  // Specifies the signal of a finished move
+#define MOTOR_WAITERS          4     // Specifies the max number of tasks waiting for moves at a time
+
+#define MOTOR_QUEUE_SIZE 32  // Specifies the motion queue capacity, must be a power of 2
+
+#define SCURVE_SHIFT 36  // Specifies the number of fractional bits of the S-curve differences
+
+/** The feed rate override scales the step periods of the moves being
+  * executed. The scale follows the override within MOTOR_ACCEL. A move is
+  * sped up no more than the override queued it with, its ramps are stretched
+  * by the square of that and its rate is limited by MOTOR_MAX_RPM, so the
+  * speed up keeps the motors within the limits.
+  */
+#define FEED_SHIFT 16   // Specifies the number of fractional bits of the period scale
+#define FEED_MIN   10   // Specifies the lowest feed rate override, %
+#define FEED_MAX   200  // Specifies the highest feed rate override, %
+#define FEED_ACCEL_K ((uint64_t)TIM_FRQ*TIM_FRQ/MOTOR_ACCEL_STEPS)  // Squared step period changing the rate by MOTOR_ACCEL per step, ticks^2
+
+/** At high step rates the period changes little from step to step, so
+  * the ramp is calculated once per 2, 4 or 8 steps, and the steps of such
+  * a group are spread evenly over its period. Every step is still a slot.
+  */
+#define MULTI_STEP_RATE 10000  // Specifies the step rate to calculate the ramp per 2 steps, it's doubled for 4 and 8 steps, steps/s
+#define MULTI_STEP_HYST 10     // Specifies how far below its rate the group size is kept, %
+#define MULTI_STEP_MAX  8      // Specifies the max number of steps per ramp calculation
+
+/** The input shaper keeps the step events of the unshaped motion until the
+  * latest impulse is through them. If the history is full, the unshaped
+  * steps are delayed, so it must hold the steps of the shaper duration
+  * (1/freq for EI) at the highest step rate.
+  */
+#define SHAPER_HISTORY  1024  // Specifies the number of step events kept, must be a power of 2
+#define SHAPER_TAPS     3     // Specifies the max number of the shaper impulses
+#define SHAPER_AMP_SHIFT 16   // Specifies the number of fractional bits of the impulse amplitudes
+#define SHAPER_MIN_FREQ 5     // Specifies the lowest shaper frequency, Hz
+#define SHAPER_MAX_FREQ 500   // Specifies the highest shaper frequency, Hz
+#define SHAPER_EI_VTOL  0.05f // Specifies the residual vibration the EI shaper tolerates
+#define SHAPER_PI       3.14159265f
+
+/**
+  * @brief Speed profile of a move.
+  * The trapezoidal step period is updated on every step using the
+  * c(n) = c(n-1) - 2*c(n-1)/(4n+1) approximation, so no floating
+  * point math is done in the IRQs. Periods are stored in timer ticks
+  * with 8 fractional bits.
+  * The S-curve rate follows r(k) = r0 + (r1 - r0)*(3x^2 - 2x^3), x = k/S,
+  * over the S steps of a ramp, so the acceleration starts and ends at zero.
+  */
+typedef struct
+{
+  Ramp ramp;                      /**< Profile type */
+
+  uint32_t c_start;               /**< Period of the first step */
+
+  uint32_t c_end;                 /**< Period of the last step */
+
+  uint32_t c_min;                 /**< Period of the cruise steps */
+
+  uint32_t n_start;               /**< Ramp step number of the start speed */
+
+  uint32_t accel_steps;           /**< Number of steps to accelerate */
+
+  uint32_t decel_start;           /**< Step number to start decelerating from */
+
+  uint32_t entry_rate;            /**< Rate of the first step, the S-curve only */
+
+  uint32_t peak_rate;             /**< Rate of the cruise steps, the S-curve only */
+
+  uint32_t exit_rate;             /**< Rate of the last step, the S-curve only */
+
+} StMotor_ProfileTypeDef;
+
+/**
+  * @brief S-curve ramp being executed.
+  * The rate is a cubic of the step number, so it's evaluated by forward
+  * differences: three additions per step and no multiplications.
+  */
+typedef struct
+{
+  uint32_t from;                  /**< Rate at the start of the ramp */
+
+  uint32_t to;                    /**< Rate at the end of the ramp */
+
+  uint32_t left;                  /**< Steps left in the ramp, 0 if there is no ramp */
+
+  int64_t diff[4];                /**< Rate offset from from and its 3 forward differences, SCURVE_SHIFT fractional bits */
+
+} StMotor_SCurveTypeDef;
+
+/**
+  * @brief Step motor driver's handler
+  */
+typedef struct
+{
+  GPIO_TypeDef* step_port;        /**< Step output port */
+
+  uint16_t step_pin;              /**< Step output pin */
+
+  GPIO_TypeDef* dir_port;         /**< Direction output port */
+
+  uint16_t dir_pin;               /**< Direction output pin */
+
+  uint8_t step_port_id;           /**< Index of the step output port in ports */
+
+  uint8_t dir_port_id;            /**< Index of the direction output port in ports */
+
+  int64_t angle;                  /**< Stores the angle at the start of the half being executed, in steps */
+
+  int8_t dir;                     /**< Stores the direction of the steps being calculated */
+
+  int32_t counter;                /**< Bresenham counter of the move being calculated */
+
+  int32_t left;                   /**< Steps of the move being calculated left, the ones not done are carried on */
+
+} StMotor_HandleTypeDef;
+
+/**
+  * @brief Queued coordinated move of all axises
+  */
+typedef struct
+{
+  uint32_t steps[AXIS_AMOUNT];    /**< Number of steps of every axis */
+
+  int8_t dir[AXIS_AMOUNT];        /**< Direction of every axis */
+
+  uint32_t dir_bsrr[MOTOR_PORTS]; /**< BSRR values of the direction outputs, indexed as ports */
+
+  uint32_t step_events;           /**< Number of steps of the fastest axis */
+
+  StMotor_ProfileTypeDef profile; /**< Speed profile of the fastest axis */
+
+  uint32_t feed_floor;            /**< Lowest period scale the profile allows, FEED_SHIFT fractional bits */
+
+} StMotor_BlockTypeDef;
+
+/**
+  * @brief Output port shared by several drivers
+  */
+typedef struct
+{
+  GPIO_TypeDef* port;             /**< Output port */
+
+  uint32_t pins;                  /**< Step pins of all drivers on the port */
+
+  uint32_t reset;                 /**< BSRR value resetting the step pins, read by DMA */
+
+} StMotor_PortTypeDef;
+
+/**
+  * @brief DMA streams writing the outputs of a port.
+  * The streams are requested by the compare events of the timer channels:
+  * the slot values are written at the update event, the step pins are
+  * reset after the step pulse.
+  */
+typedef struct
+{
+  DMA_Stream_TypeDef* set_stream;   /**< Stream writing the slot values */
+
+  uint32_t set_channel;             /**< Timer channel requesting set_stream */
+
+  uint32_t set_request;             /**< Timer DMA request of set_channel */
+
+  DMA_Stream_TypeDef* reset_stream; /**< Stream resetting the step pins */
+
+  uint32_t reset_channel;           /**< Timer channel requesting reset_stream */
+
+  uint32_t reset_request;           /**< Timer DMA request of reset_channel */
+
+} StMotor_PortDMATypeDef;
+
+/**
+  * @brief Task waiting for a move
+  */
+typedef struct
+{
+  volatile osThreadId thread;     /**< Waiting task, NULL if the entry is free */
+
+  volatile uint32_t move;         /**< Number of the move the task is waiting for */
+
+  int32_t signal;                 /**< Signal sent to the task when the move is finished */
+
+} StMotor_WaiterTypeDef;
+
+/**
+  * @brief Step event of the unshaped motion
+  */
+typedef struct
+{
+  uint32_t time;                  /**< Time of the event, in timer ticks */
+
+  int8_t delta[AXIS_AMOUNT];      /**< Steps of every axis */
+
+  uint8_t ends;                   /**< Number of the moves finished by the event */
+
+} StMotor_EventTypeDef;
+
+/**
+  * @brief Impulse of the input shaper
+  */
+typedef struct
+{
+  uint32_t delay;                 /**< Delay of the impulse, in timer ticks */
+
+  int32_t amp;                    /**< Amplitude of the impulse, SHAPER_AMP_SHIFT fractional bits */
+
+} StMotor_ImpulseTypeDef;
+
+/**
+  * @brief Input shaper.
+  * The motion of every axis is convolved with the impulses: the position
+  * output is the sum of the unshaped positions delayed by the impulses and
+  * weighted by their amplitudes, rounded to steps. The amplitudes are
+  * positive and sum up to 1, so the output ends at the unshaped position.
+  * Every impulse walks the history of the unshaped step events on its own,
+  * the events of the impulses closer than a slot may be are output together.
+  */
+typedef struct
+{
+  uint8_t taps;                   /**< Number of the impulses, 0 if the shaper is off */
+
+  StMotor_ImpulseTypeDef impulse[SHAPER_TAPS];  /**< Impulses, the delays ascend */
+
+  uint32_t read[SHAPER_TAPS];     /**< Next event of the history of every impulse */
+
+  uint32_t head;                  /**< Number of the events put to the history */
+
+  uint32_t time;                  /**< Time of the last unshaped event */
+
+  uint32_t out_time;              /**< Time of the last slot calculated */
+
+  int32_t rest[AXIS_AMOUNT];      /**< Shaped position minus the output one, SHAPER_AMP_SHIFT fractional bits */
+
+  int8_t dir[AXIS_AMOUNT];        /**< Direction outputs */
+
+  uint32_t ends;                  /**< Number of the moves the latest impulse is through, not accounted yet */
+
+  uint8_t pending;                /**< The output event below is waiting for its slots */
+
+  uint8_t turn;                   /**< The direction outputs have to be changed before the output event */
+
+  uint32_t ev_time;               /**< Time of the output event */
+
+  uint32_t ev_dir_bsrr[MOTOR_PORTS]; /**< BSRR values of the direction outputs of the output event */
+
+  int8_t ev_delta[AXIS_AMOUNT];   /**< Steps of every axis of the output event */
+
+} StMotor_ShaperTypeDef;
+
+/**
+  * @brief Step engine's handler.
+  * One timer drives all axises. Its update events are slots: the outputs
+  * of a slot and the period of it are written by DMA at the update event,
+  * so no IRQ is involved in stepping. The moves are converted
+  * to slots ahead of the timer: the fastest axis steps in every slot
+  * (except the slots splitting long periods), the other axises are
+  * stepped by the Bresenham algorithm, so all axises start and finish
+  * a move together. The CPU calculates the slots only when DMA is through
+  * a half of the table, and the position is counted by halves as well.
+  * The position is read without disabling the IRQs: the writers make seq
+  * odd while updating it, and the readers retry if seq has changed.
+  */
+typedef struct
+{
+  TIM_HandleTypeDef htim;         /**< Timer to be used */
+
+  DMA_HandleTypeDef hdma;         /**< DMA stream writing the periods to the timer */
+
+  DMA_HandleTypeDef hdma_set[MOTOR_PORTS];   /**< DMA streams writing the slot values to the ports */
+
+  DMA_HandleTypeDef hdma_reset[MOTOR_PORTS]; /**< DMA streams resetting the step pins */
+
+  StMotor_BlockTypeDef* block;    /**< Move being calculated, NULL if there is no one */
+
+  uint32_t next;                  /**< Number of the next move to calculate */
+
+  uint32_t move;                  /**< Number of the move being calculated */
+
+  uint32_t done;                  /**< Number of the moves calculated */
+
+  uint32_t step;                  /**< Number of step events calculated in the current move */
+
+  uint32_t end;                   /**< Number of step events of the current move, changed by a quick stop */
+
+  uint32_t n;                     /**< Current ramp step number */
+
+  uint32_t c;                     /**< Current step period */
+
+  uint32_t c_frac;                /**< Fractional ticks not applied to the slots yet */
+
+  uint8_t multi;                  /**< Number of steps per ramp calculation: 1, 2, 4 or MULTI_STEP_MAX */
+
+  uint8_t multi_left;             /**< Number of steps of the group left */
+
+  uint8_t multi_extra;            /**< Number of steps of the group left to be given an extra tick */
+
+  uint32_t multi_ticks;           /**< Period of the steps of the group */
+
+  StMotor_SCurveTypeDef scurve;   /**< S-curve ramp of the move being calculated */
+
+  uint32_t wait;                  /**< Ticks from the last slot to the next step */
+
+  uint8_t turn;                   /**< The direction outputs have to be changed before the next step */
+
+  uint32_t slot;                  /**< Last slot calculated, its period isn't known yet */
+
+  uint32_t half;                  /**< Half of the table being executed */
+
+  uint32_t tail[2];               /**< queue_tail after every half of the table is executed */
+
+  int32_t delta[2][AXIS_AMOUNT];  /**< Steps of every axis in every half of the table */
+
+  uint8_t steps[2];               /**< There are steps in every half of the table */
+
+  uint16_t pulse;                 /**< Step pulse width, in timer ticks */
+
+  uint16_t dir_setup;             /**< Direction setup time, in timer ticks */
+
+  volatile uint32_t seq;          /**< Position generation, odd while the position is being updated */
+
+  volatile uint8_t halted;        /**< Mask of the axises not stepped in the move halt_move */
+
+  uint32_t halt_move;             /**< Number of the move the axises are halted in */
+
+  int32_t carry[AXIS_AMOUNT];     /**< Steps dropped by the halts, made up by the next move calculated */
+
+  volatile uint8_t stop;          /**< A quick stop is requested */
+
+  uint8_t dropped;                /**< Number of the moves dropped by the quick stop, they finish with the current one */
+
+  uint32_t feed_scale;            /**< Scale of the step periods applied, FEED_SHIFT fractional bits */
+
+  uint32_t period;                /**< Scaled period of the steps being output, in timer ticks with 8 fractional bits */
+
+  StMotor_ShaperTypeDef shaper;   /**< Input shaper of the steps, set up at the engine start */
+
+} StMotor_EngineTypeDef;
+
+static StMotor_HandleTypeDef drivers[AXIS_AMOUNT] =
+                          { [_X] = {.step_port = GPIOA, .step_pin = GPIO_PIN_2,   // X-axis driver's handler
+                                    .dir_port = GPIOA, .dir_pin = GPIO_PIN_1},
+                            [_Y] = {.step_port = GPIOB, .step_pin = GPIO_PIN_9,   // Y-axis driver's handler
+                                    .dir_port = GPIOA, .dir_pin = GPIO_PIN_4},
+                            [_Z] = {.step_port = GPIOB, .step_pin = GPIO_PIN_8,   // Z-axis driver's handler
+                                    .dir_port = GPIOA, .dir_pin = GPIO_PIN_7}
+                          };
+
+static StMotor_EngineTypeDef engine;
+
+static const StMotor_PortDMATypeDef port_dma[MOTOR_PORTS] =
+                          { {DMA2_Stream2, TIM_CHANNEL_1, TIM_DMA_CC1,    // TIM8_CH1 request
+                             DMA2_Stream4, TIM_CHANNEL_3, TIM_DMA_CC3},   // TIM8_CH3 request
+                            {DMA2_Stream3, TIM_CHANNEL_2, TIM_DMA_CC2,    // TIM8_CH2 request
+                             DMA2_Stream7, TIM_CHANNEL_4, TIM_DMA_CC4}    // TIM8_CH4 request
+                          };
+
+/** The outputs of all drivers grouped by ports, so the outputs sharing
+  * a port are changed by one write and switch at the same time.
+  */
+static StMotor_PortTypeDef ports[MOTOR_PORTS];
+static uint8_t ports_amount;
+
+/** The slot table.
+  * slot_arr is streamed to the timer and slot_bsrr to the ports by DMA,
+  * slot_delta is read by the position counting. A slot is either a step
+  * of the motors, a change of directions or a pause.
+  */
+static uint16_t slot_arr[MOTOR_SLOTS];                // ARR value of every slot
+static uint32_t slot_bsrr[MOTOR_PORTS][MOTOR_SLOTS];  // BSRR values of every slot, indexed as ports
+static int8_t slot_delta[MOTOR_SLOTS][AXIS_AMOUNT];   // Steps of every axis in every slot
+static uint32_t slot_move[MOTOR_SLOTS];               // Number of the move every slot is output in
+
+/** The motion queue.
+  * The queue is filled by the task and emptied by the refill IRQ handler,
+  * which calculates the next move right after the current one, so
+  * consecutive moves don't wait for the caller.
+  */
+static StMotor_BlockTypeDef queue[MOTOR_QUEUE_SIZE];
+static volatile uint32_t queue_head;         // Written by the task only
+static volatile uint32_t queue_tail;         // Written by the IRQ handler only
+static volatile uint8_t queue_running;       // The queue is being executed
+static volatile uint8_t queue_stopping;      // A quick stop is being executed, no moves are queued
+static int64_t queue_angle[AXIS_AMOUNT];     // Angle at the end of the last queued move, in steps
+static uint32_t queue_axis_last[AXIS_AMOUNT] = {0xffffffff, 0xffffffff, 0xffffffff};
+                                             // Number of the last queued move of every axis
+static StMotor_WaiterTypeDef queue_waiters[MOTOR_WAITERS];
+static Ramp queue_ramp;                      // Profile of the moves being queued
+static StMotor_ImpulseTypeDef queue_impulse[SHAPER_TAPS];  // Input shaper applied from the next queue start
+static uint8_t queue_taps;
+static volatile uint32_t feed_target = 1 << FEED_SHIFT;  // Scale of the step periods set by the override
+static volatile uint32_t feed_percent = 100;             // Feed rate override, %
+
+static StMotor_EventTypeDef shaper_history[SHAPER_HISTORY];
+
+static void FillHalf(uint32_t half);
+static void EngineStop(void);
+static void ReleaseStreams(void);
+static uint8_t IsShaperIdle(void);
+static void ShaperStop(void);
+
+static void ResetStepOutputs(void)
+{
+  for (uint8_t i = 0; i < ports_amount; i++)
+  {
+    ports[i].port->BSRR = ports[i].reset;
+  }
+}
+
+/**
+  * @brief Start updating the position, the readers retry until it's done
+  */
+static void PositionWriteBegin(void)
+{
+  engine.seq++;
+  __DMB();
+}
+
+/**
+  * @brief Finish updating the position
+  */
+static void PositionWriteEnd(void)
+{
+  __DMB();
+  engine.seq++;
+}
+
+/**
+  * @brief Check whether the axis is halted in the move specified
+  */
+static uint8_t IsHalted(uint8_t axis, uint32_t move)
+{
+  return ((engine.halted >> axis) & 1) && (move == engine.halt_move);
+}
+
+/**
+  * @brief Get the number of the move the last slot output belongs to, the
+  * next move to be queued if the queue is idle. The refill IRQ must not
+  * come in.
+  */
+static uint32_t CurrentMove(void)
+{
+  if (!queue_running) return queue_head;
+  uint32_t done = (MOTOR_SLOTS - __HAL_DMA_GET_COUNTER(&engine.hdma)) & (MOTOR_SLOTS - 1);
+  return slot_move[(done - 1) & (MOTOR_SLOTS - 1)];
+}
+
+/**
+  * @brief Carry the steps of the move being calculated left to the next move
+  */
+static void CarryLeft(void)
+{
+  for (uint8_t i = 0; i < AXIS_AMOUNT; i++)
+  {
+    engine.carry[i] += drivers[i].dir*drivers[i].left;
+    drivers[i].left = 0;
+  }
+}
+
+/**
+  * @brief Add the steps carried to the move loaded, so it ends at its
+  * target as if no step had been dropped.
+  */
+static void CarryOn(StMotor_BlockTypeDef* block)
+{
+  for (uint8_t i = 0; i < AXIS_AMOUNT; i++)
+  {
+    if (engine.carry[i] == 0) continue;
+    int64_t delta = (int64_t)block->dir[i]*block->steps[i] + engine.carry[i];
+    engine.carry[i] = 0;
+    block->dir[i] = (delta < 0) ? -1 : 1;
+    block->steps[i] = (uint32_t)((delta < 0) ? -delta : delta);
+    // The extra steps are done at the exit rate, the ramps stay as planned.
+    if (block->steps[i] > block->step_events) block->step_events = block->steps[i];
+    uint32_t pin = drivers[i].dir_pin;
+    block->dir_bsrr[drivers[i].dir_port_id] &= ~(pin | pin << 16);
+    if (block->steps[i] == 0) continue;
+    block->dir_bsrr[drivers[i].dir_port_id] |= (block->dir[i] > 0) ? pin : pin << 16;
+  }
+}
+
+/**
+  * @brief Release the halted axises once the queue is idle or flushed, the
+  * steps carried are dropped as the queue is synced to the angles then
+  */
+static void ReleaseHalts(void)
+{
+  engine.halted = 0;
+  for (uint8_t i = 0; i < AXIS_AMOUNT; i++)
+  {
+    engine.carry[i] = 0;
+    drivers[i].left = 0;
+  }
+}
+
+/**
+  * @brief Account the steps and the moves of the half of the table
+  * executed by the timer
+  */
+static void AccountHalf(uint32_t half)
+{
+  queue_tail = engine.tail[half];
+  for (uint8_t i = 0; i < AXIS_AMOUNT; i++)
+  {
+    drivers[i].angle += engine.delta[half][i];
+  }
+  for (uint8_t i = 0; i < MOTOR_WAITERS; i++)
+  {
+    if ( (queue_waiters[i].thread != NULL) && IsMotorMoveDone(queue_waiters[i].move) )
+    {
+      HAL_NVIC_SetPendingIRQ(NOTIFY_IRQ);
+      break;
+    }
+  }
+}
+
+/**
+  * @brief Account the half of the table executed and calculate it again.
+  * Returns 0 if the engine is stopped.
+  */
+static uint8_t HalfDone(uint32_t half)
+{
+  PositionWriteBegin();
+  AccountHalf(half);
+  engine.half = half ^ 1;
+  if ( !engine.steps[half ^ 1] && (engine.block == NULL) && (engine.next == queue_head) && IsShaperIdle() )
+  {
+    // Nothing is stepped now and there is nothing to calculate.
+    EngineStop();
+    AccountHalf(half ^ 1);
+    ShaperStop();
+    queue_running = 0;
+    queue_stopping = 0;
+    ReleaseHalts();
+    PositionWriteEnd();
+    return 0;
+  }
+  PositionWriteEnd();
+  // The half is rewritten after the position is updated, so the readers
+  // still summing it up see seq changed.
+  FillHalf(half);
+  return 1;
+}
+
+void DMA2_Stream1_IRQHandler(void)
+{
+  // The first half is over by HT and the second one by TC, so a late IRQ
+  // accounts both of them in the order they were executed.
+  uint32_t flag = (engine.half == 0) ? __HAL_DMA_GET_HT_FLAG_INDEX(&engine.hdma) :
+                                       __HAL_DMA_GET_TC_FLAG_INDEX(&engine.hdma);
+  while (__HAL_DMA_GET_FLAG(&engine.hdma, flag))
+  {
+    __HAL_DMA_CLEAR_FLAG(&engine.hdma, flag);
+    if (!HalfDone(engine.half)) break;
+    flag = (engine.half == 0) ? __HAL_DMA_GET_HT_FLAG_INDEX(&engine.hdma) :
+                                __HAL_DMA_GET_TC_FLAG_INDEX(&engine.hdma);
+  }
+}
+
+void TIM1_TRG_COM_TIM11_IRQHandler(void)
+{
+  for (uint8_t i = 0; i < MOTOR_WAITERS; i++)
+  {
+    osThreadId waiter = queue_waiters[i].thread;
+    if ( (waiter != NULL) && IsMotorMoveDone(queue_waiters[i].move) )
+    {
+      queue_waiters[i].thread = NULL;
+      osSignalSet(waiter, queue_waiters[i].signal);
+    }
+  }
+}
+
+/**
+  * @brief Find the port in the list or add it there.
+  * Returns the index of the port, MOTOR_PORTS if the list is full.
+  */
+static uint8_t AddPort(GPIO_TypeDef* port)
+{
+  uint8_t i = 0;
+  while ( (i < ports_amount) && (ports[i].port != port) ) i++;
+  if (i == MOTOR_PORTS) return i;
+  if (i == ports_amount)
+  {
+    ports[i].port = port;
+    ports[i].pins = 0;
+    ports[i].reset = 0;
+    ports_amount++;
+  }
+  return i;
+}
+
+static Error InitPorts(void)
+{
+  ports_amount = 0;
+  for (uint8_t i = 0; i < AXIS_AMOUNT; i++)
+  {
+    StMotor_HandleTypeDef* driver = &drivers[i];
+    driver->step_port_id = AddPort(driver->step_port);
+    driver->dir_port_id = AddPort(driver->dir_port);
+    if ( (driver->step_port_id == MOTOR_PORTS) || (driver->dir_port_id == MOTOR_PORTS) )
+    {
+      return _OutOfRange;
+    }
+    ports[driver->step_port_id].pins |= driver->step_pin;
+    ports[driver->step_port_id].reset = ports[driver->step_port_id].pins << 16;
+  }
+  return _Success;
+}
+
+static void InitIRQ(void)
+{
+  HAL_NVIC_SetPriority(MOTOR_DMA_IRQ, REFILL_IRQ_PR_PRIORITY, REFILL_IRQ_SUB_PRIORITY);
+  HAL_NVIC_EnableIRQ(MOTOR_DMA_IRQ);
+
+  HAL_NVIC_SetPriority(NOTIFY_IRQ, NOTIFY_IRQ_PR_PRIORITY, NOTIFY_IRQ_SUB_PRIORITY);
+  HAL_NVIC_EnableIRQ(NOTIFY_IRQ);
+}
+
+/**
+  * @brief Init a circular memory to peripheral DMA stream requested by the timer.
+  * align is the data size of both the memory and the peripheral.
+  */
+static HAL_StatusTypeDef InitDMA(DMA_HandleTypeDef *hdma, DMA_Stream_TypeDef *stream,
+                                 uint32_t mem_inc, uint32_t align)
+{
+  hdma->Instance = stream;
+  hdma->Init.Channel = MOTOR_DMA_CH;
+  hdma->Init.Direction = DMA_MEMORY_TO_PERIPH;
+  hdma->Init.PeriphInc = DMA_PINC_DISABLE;
+  hdma->Init.MemInc = mem_inc;
+  hdma->Init.PeriphDataAlignment = align;
+  hdma->Init.MemDataAlignment = (align == DMA_PDATAALIGN_WORD) ? DMA_MDATAALIGN_WORD : DMA_MDATAALIGN_HALFWORD;
+  hdma->Init.Mode = DMA_CIRCULAR;
+  hdma->Init.Priority = DMA_PRIORITY_VERY_HIGH;
+  hdma->Init.FIFOMode = DMA_FIFOMODE_DISABLE;
+  return HAL_DMA_Init(hdma);
+}
+
+static Error InitOutput(StMotor_EngineTypeDef *engine, TIM_TypeDef *timer)
+{
+  engine->htim.Instance = timer;
+  engine->htim.Init.Prescaler = TIM_PRSC;
+  engine->htim.Init.CounterMode = TIM_COUNTERMODE_UP;
+  engine->htim.Init.ClockDivision = TIM_CLOCKDIVISION_DIV1;
+  engine->htim.Init.Period = 0xffff;
+  engine->htim.Init.RepetitionCounter = 0;
+  if (HAL_TIM_Base_Init(&engine->htim) != HAL_OK) return _HALError;
+  // ARR isn't buffered: DMA writes the period of a slot right at its update event.
+  engine->htim.Instance->CR1 &= ~TIM_CR1_ARPE;
+  engine->pulse = (uint16_t)((uint64_t)MOTOR_PULSE_WIDTH*TIM_FRQ/1000000 + 1);
+  engine->dir_setup = (uint16_t)((uint64_t)MOTOR_DIR_SETUP*TIM_FRQ/1000000 + 1);
+
+  if (InitDMA(&engine->hdma, MOTOR_DMA, DMA_MINC_ENABLE, DMA_PDATAALIGN_HALFWORD) != HAL_OK)
+  {
+    return _HALError;
+  }
+
+  // The slot values are written at the update event, since the compare
+  // value 0 matches it, and the step pins are reset after the pulse.
+  for (uint8_t i = 0; i < ports_amount; i++)
+  {
+    const StMotor_PortDMATypeDef* dma = &port_dma[i];
+    __HAL_TIM_SET_COMPARE(&engine->htim, dma->set_channel, 0);
+    __HAL_TIM_SET_COMPARE(&engine->htim, dma->reset_channel, engine->pulse);
+    if ( (InitDMA(&engine->hdma_set[i], dma->set_stream, DMA_MINC_ENABLE, DMA_PDATAALIGN_WORD) != HAL_OK) ||
+         (InitDMA(&engine->hdma_reset[i], dma->reset_stream, DMA_MINC_DISABLE, DMA_PDATAALIGN_WORD) != HAL_OK) )
+    {
+      return _HALError;
+    }
+  }
+
+  return _Success;
+}
+
+static void DeInitIRQ(void)
+{
+  HAL_NVIC_DisableIRQ(MOTOR_DMA_IRQ);
+  HAL_NVIC_DisableIRQ(NOTIFY_IRQ);
+}
+
+static Error DeInitOutput(StMotor_EngineTypeDef *engine)
+{
+  // The streams of the running engine are busy and aren't deinitialized.
+  if (!queue_running) ReleaseStreams();
+  for (uint8_t i = 0; i < ports_amount; i++)
+  {
+    if (HAL_DMA_DeInit(&engine->hdma_set[i]) != HAL_OK) return _HALError;
+    if (HAL_DMA_DeInit(&engine->hdma_reset[i]) != HAL_OK) return _HALError;
+  }
+  if (HAL_DMA_DeInit(&engine->hdma) != HAL_OK) return _HALError;
+  if (HAL_TIM_Base_DeInit(&engine->htim) != HAL_OK) return _HALError;
+  return _Success;
+}
+
+static int64_t AngleToSteps(double angle)
+{
+  // Round to the nearest step, so converting MotorGetAngle() back is exact.
+  return llround(angle*MOTOR_STEP_DIV/MOTOR_STEP_DG);
+}
+
+/**
+  * @brief Get the ramp step number of the rate: the speed of the motor
+  * accelerating with accel (steps/s^2) is sqrt(2*a*n) after n steps.
+  */
+static uint32_t RateToRampStep(uint32_t rate, uint32_t accel)
+{
+  return (uint32_t)(((uint64_t)rate*rate >> (2*MOTOR_RATE_SHIFT))/(2*accel));
+}
+
+/**
+  * @brief Get the number of steps of the S-curve ramp between the rates.
+  * The acceleration of the ramp peaks below (high - low)*(1.5*low + high - low)/S,
+  * so it doesn't exceed accel (steps/s^2).
+  */
+static uint32_t SCurveSteps(uint32_t low, uint32_t high, uint32_t accel)
+{
+  uint64_t d = high - low;
+  uint64_t v = d*(3*(uint64_t)low/2 + d) >> (2*MOTOR_RATE_SHIFT);
+  return (uint32_t)((v + accel - 1)/accel);
+}
+
+/**
+  * @brief Calculate the ramps of the S-curve profile.
+  * The rate changes between the steps, so the ramps take steps - 1 steps
+  * at most. If there are not enough steps to reach rate, the highest peak
+  * rate fitting the move is searched for. If even the entry and the exit
+  * rates can't be joined in time, the ramp between them is squeezed into
+  * the move, so the speeds of consecutive moves still match.
+  */
+static void ComputeSCurve(uint32_t rate, uint32_t entry_rate, uint32_t exit_rate,
+                          uint32_t steps, uint32_t accel, StMotor_ProfileTypeDef* profile)
+{
+  uint32_t room = steps - 1;
+  uint32_t peak = rate;
+  if (SCurveSteps(entry_rate, peak, accel) + SCurveSteps(exit_rate, peak, accel) > room)
+  {
+    uint32_t low = (entry_rate < exit_rate) ? entry_rate : exit_rate;
+    uint32_t high = (entry_rate < exit_rate) ? exit_rate : entry_rate;
+    peak = high;
+    if (SCurveSteps(low, high, accel) < room)
+    {
+      // The ramps fit the move with high and don't with rate.
+      while (rate - peak > 1)
+      {
+        uint32_t mid = peak + (rate - peak)/2;
+        if (SCurveSteps(entry_rate, mid, accel) + SCurveSteps(exit_rate, mid, accel) <= room) peak = mid; else rate = mid;
+      }
+    }
+  }
+  uint32_t accel_steps = SCurveSteps(entry_rate, peak, accel);
+  uint32_t decel_steps = SCurveSteps(exit_rate, peak, accel);
+  if (accel_steps > room) accel_steps = room;
+  if (decel_steps > room - accel_steps) decel_steps = room - accel_steps;
+  profile->c_min = (uint32_t)((((uint64_t)TIM_FRQ << (8 + MOTOR_RATE_SHIFT)) + peak/2)/peak);
+  profile->accel_steps = accel_steps;
+  profile->decel_start = steps - decel_steps;
+  profile->entry_rate = entry_rate;
+  profile->peak_rate = peak;
+  profile->exit_rate = exit_rate;
+}
+
+/**
+  * @brief Calculate the speed profile of a move.
+  * The motor enters the move at entry_rate, accelerates with accel (steps/s^2)
+  * up to rate, and decelerates to exit_rate at the end of the move. If there
+  * are not enough steps to reach rate, the profile becomes triangular.
+  * The entry and exit rates aren't lower than start_rate, since the motors
+  * start and stop at this speed without ramping.
+  * Only integer math is used, so short moves are cheap to put to the queue.
+  * The S-curve ramps are calculated by ComputeSCurve().
+  */
+static Error ComputeProfile(Ramp ramp, uint32_t rate, uint32_t entry_rate, uint32_t exit_rate,
+                            uint32_t start_rate, uint32_t steps, uint32_t accel,
+                            StMotor_ProfileTypeDef* profile)
+{
+  if (entry_rate < start_rate) entry_rate = start_rate;
+  if (exit_rate < start_rate) exit_rate = start_rate;
+  if (entry_rate > rate) entry_rate = rate;
+  if (exit_rate > rate) exit_rate = rate;
+  // Periods in timer ticks with 8 fractional bits, the cruise one is rounded.
+  uint64_t c_start = ((uint64_t)TIM_FRQ << (8 + MOTOR_RATE_SHIFT))/entry_rate;
+  uint64_t c_end = ((uint64_t)TIM_FRQ << (8 + MOTOR_RATE_SHIFT))/exit_rate;
+  uint64_t c_min = (((uint64_t)TIM_FRQ << (8 + MOTOR_RATE_SHIFT)) + rate/2)/rate;
+  // The ramp doubles the periods, so they must fit 31 bits. A step may be
+  // followed by a direction change, both slots must outlast the step pulse.
+  if ( (c_start > 0x7fffffff) || (c_end > 0x7fffffff) ||
+       (c_min < ((uint32_t)2*(engine.pulse + engine.dir_setup) << 8)) )
+  {
+    return _OutOfRange;
+  }
+  profile->ramp = ramp;
+  profile->c_start = (uint32_t)c_start;
+  profile->c_end = (uint32_t)c_end;
+  if (ramp == _SCurve)
+  {
+    ComputeSCurve(rate, entry_rate, exit_rate, steps, accel, profile);
+    return _Success;
+  }
+  int32_t n_entry = RateToRampStep(entry_rate, accel);
+  int32_t n_exit = RateToRampStep(exit_rate, accel);
+  int32_t n_peak = RateToRampStep(rate, accel);
+  if ( (n_peak - n_entry) + (n_peak - n_exit) > (int32_t)steps )
+  {
+    n_peak = ((int32_t)steps + n_entry + n_exit)/2;
+    if (n_peak < n_entry) n_peak = n_entry;  // Can't slow down in time, decelerate all the way
+    if (n_peak < n_exit) n_peak = n_exit;    // Can't speed up in time, accelerate all the way
+  }
+  uint32_t accel_steps = n_peak - n_entry;
+  uint32_t decel_steps = n_peak - n_exit;
+  if (accel_steps > steps) accel_steps = steps;
+  if (decel_steps > steps - accel_steps) decel_steps = steps - accel_steps;
+  profile->c_min = (uint32_t)c_min;
+  profile->n_start = n_entry;
+  profile->accel_steps = accel_steps;
+  profile->decel_start = steps - decel_steps;
+  return _Success;
+}
+
+/**
+  * @brief Move the period scale toward the feed rate override over k steps.
+  * The rate of a step period of t changes by MOTOR_ACCEL*t per step at
+  * most, that is the scale changes by (t^2)/FEED_ACCEL_K of it. The scale is
+  * read once, so the override may be changed at any time. The scale doesn't
+  * go below the one the move being calculated is queued with, and it's kept
+  * while the motors are quickly stopped.
+  */
+static void FeedStep(uint32_t c, uint32_t k)
+{
+  if (queue_stopping) return;
+  uint32_t target = feed_target;
+  if (target < engine.block->feed_floor) target = engine.block->feed_floor;
+  uint32_t scale = engine.feed_scale;
+  if (scale == target) return;
+  uint64_t t = ((uint64_t)c*scale >> FEED_SHIFT) >> 8;
+  uint64_t change = (t < (1 << 20)) ? (uint64_t)scale*t*t/FEED_ACCEL_K*k : scale;
+  if (change == 0) change = 1;
+  if (scale < target) engine.feed_scale = (target - scale > change) ? scale + (uint32_t)change : target;
+  else engine.feed_scale = (scale - target > change) ? scale - (uint32_t)change : target;
+}
+
+/**
+  * @brief Convert k step periods c (8 fractional bits) to timer ticks.
+  * The period is scaled by the feed rate override. The fractional part is
+  * accumulated and an extra tick is added to the periods it carries to,
+  * so the average step rate is exact even in cruise.
+  */
+static uint32_t PeriodToTicks(uint32_t c, uint32_t k)
+{
+  FeedStep(c, k);
+  engine.period = (uint32_t)((uint64_t)c*engine.feed_scale >> FEED_SHIFT);
+  uint64_t scaled = (uint64_t)engine.period*k;
+  engine.c_frac += (uint32_t)scaled & 0xff;
+  uint32_t ticks = (uint32_t)(scaled >> 8) + (engine.c_frac >> 8);
+  engine.c_frac &= 0xff;
+  // A step may be followed by a direction change, see ComputeProfile().
+  uint32_t min = k*(engine.pulse + engine.dir_setup + 1u);
+  return (ticks < min) ? min : ticks;
+}
+
+/**
+  * @brief Start the S-curve ramp from the rate to the rate of steps.
+  * r(k) - from = a2*k^2 - a3*k^3 with a2 = 3*(to - from)/S^2 and
+  * a3 = 2*(to - from)/S^3, the differences are calculated once per ramp.
+  */
+static void SCurveStart(uint32_t from, uint32_t to, uint32_t steps)
+{
+  StMotor_SCurveTypeDef* scurve = &engine.scurve;
+  scurve->from = from;
+  scurve->to = to;
+  scurve->left = steps;
+  for (uint8_t i = 0; i < 4; i++)
+  {
+    scurve->diff[i] = 0;
+  }
+  if (steps < 2) return;  // The only step is at the target rate
+  // The errors of a3 add up as k^3, so it's rounded and a2 is fitted to it:
+  // the ramp ends at to and doesn't run into it before the last step.
+  uint64_t d = (from < to) ? to - from : from - to;
+  uint64_t s2 = (uint64_t)steps*steps;
+  uint64_t s3 = s2*steps;
+  int64_t a3 = (int64_t)(((2*d << SCURVE_SHIFT) + s3/2)/s3);
+  int64_t a2 = (int64_t)(((d << SCURVE_SHIFT) + (uint64_t)a3*s3 + s2/2)/s2);
+  if (from > to)
+  {
+    a2 = -a2;
+    a3 = -a3;
+  }
+  scurve->diff[1] = a2 - a3;
+  scurve->diff[2] = 2*a2 - 6*a3;
+  scurve->diff[3] = -6*a3;
+}
+
+/**
+  * @brief Get the rate of the next step of the S-curve ramp.
+  * The last step is at the target rate exactly, so the rounding errors
+  * of the differences don't add up from ramp to ramp.
+  */
+static uint32_t SCurveStep(void)
+{
+  StMotor_SCurveTypeDef* scurve = &engine.scurve;
+  uint32_t rate = scurve->to;
+  scurve->left--;
+  if (scurve->left != 0)
+  {
+    scurve->diff[0] += scurve->diff[1];
+    scurve->diff[1] += scurve->diff[2];
+    scurve->diff[2] += scurve->diff[3];
+    int64_t r = (int64_t)scurve->from + (scurve->diff[0] >> SCURVE_SHIFT);
+    uint32_t low = (scurve->from < scurve->to) ? scurve->from : scurve->to;
+    uint32_t high = (scurve->from < scurve->to) ? scurve->to : scurve->from;
+    rate = (r < low) ? low : ((r > high) ? high : (uint32_t)r);
+  }
+  return rate;
+}
+
+/**
+  * @brief Advance the ramp by k steps and calculate their period, in timer
+  * ticks. The steps are given the period of the first one, so the rate is
+  * converted to the period and the ticks once.
+  */
+static uint32_t RampStep(uint32_t k)
+{
+  StMotor_ProfileTypeDef* profile = &engine.block->profile;
+  uint32_t c = 0;
+  for (uint32_t j = 0; j < k; j++)
+  {
+    uint32_t step = engine.step + j;
+    if (profile->ramp == _SCurve)
+    {
+      if (step == profile->decel_start)
+      {
+        SCurveStart(profile->peak_rate, profile->exit_rate, engine.end - profile->decel_start);
+      }
+      if (engine.scurve.left == 0)
+      {
+        engine.c = profile->c_min;
+      }
+      else
+      {
+        uint32_t rate = SCurveStep();
+        if (j == 0) engine.c = (uint32_t)(((uint64_t)TIM_FRQ << (8 + MOTOR_RATE_SHIFT))/rate);
+      }
+    }
+    else if (step < profile->accel_steps)
+    {
+      engine.n++;
+      engine.c -= (2*engine.c)/(4*engine.n + 1);
+      if (engine.c < profile->c_min) engine.c = profile->c_min;
+    }
+    else if (step >= profile->decel_start)
+    {
+      engine.c += (2*engine.c)/(4*engine.n - 1);
+      if (engine.n > 1) engine.n--;
+      if (engine.c > profile->c_end) engine.c = profile->c_end;
+    }
+    if (j == 0) c = engine.c;
+  }
+  return PeriodToTicks(c, k);
+}
 
 /**
-  * @brief Step motor driver's handler
+  * @brief Calculate the ticks to the next step.
+  * The ramp is calculated for a group of steps, the group is doubled when
+  * the rate reaches its multi-step rate and halved when the rate falls
+  * below the rate of the group less MULTI_STEP_HYST. A group doesn't go
+  * past the end of the move.
   */
-typedef struct
+static uint32_t NextStep(void)
 {
-  TIM_HandleTypeDef htim;         /**< Timer to be used */
-
-  TIM_OC_InitTypeDef sConfigOC;   /**< Configuration structure */
-
-  int64_t set_angle;              /**< Stores set angle value, in steps */
-
-  int64_t angle;                  /**< Stores the current angle value, in steps */
-
-  uint8_t busy;                   /**< The task is being executed */
-
-  int8_t dir;                     /**< Stores the current direction */
+  if (engine.multi_left == 0)
+  {
+    // Rates are compared as TIM_FRQ*MULTI_STEP_RATE/rate.
+    uint64_t r = (uint64_t)(engine.c >> 8)*MULTI_STEP_RATE;
+    if ( (engine.multi < MULTI_STEP_MAX) && (r*engine.multi < TIM_FRQ) )
+    {
+      engine.multi *= 2;
+    }
+    else if ( (engine.multi > 1) && (r*engine.multi*100 > (uint64_t)TIM_FRQ*2*(100 + MULTI_STEP_HYST)) )
+    {
+      engine.multi /= 2;
+    }
+    uint32_t k = engine.multi;
+    if (k > engine.end - engine.step) k = engine.end - engine.step;
+    uint32_t ticks = RampStep(k);
+    engine.multi_ticks = ticks/k;
+    engine.multi_extra = ticks % k;
+    engine.multi_left = k;
+  }
+  engine.multi_left--;
+  if (engine.multi_extra == 0) return engine.multi_ticks;
+  engine.multi_extra--;
+  return engine.multi_ticks + 1;
+}
 
-} StMotor_HandleTypeDef;
+/**
+  * @brief Start calculating the next queued move.
+  * Returns NULL if there is nothing to do.
+  */
+static StMotor_BlockTypeDef* LoadBlock(void)
+{
+  if (engine.next == queue_head) return NULL;
+  StMotor_BlockTypeDef* block = &queue[engine.next & (MOTOR_QUEUE_SIZE - 1)];
+  StMotor_ProfileTypeDef* profile = &block->profile;
+  engine.move = engine.next++;
+  engine.turn = 0;
+  CarryOn(block);
+  for (uint8_t i = 0; i < AXIS_AMOUNT; i++)
+  {
+    StMotor_HandleTypeDef* driver = &drivers[i];
+    driver->counter = -(int32_t)(block->step_events >> 1);
+    driver->left = (int32_t)block->steps[i];
+    if ( (block->steps[i] != 0) && (driver->dir != block->dir[i]) )
+    {
+      driver->dir = block->dir[i];
+      engine.turn = 1;
+    }
+  }
+  engine.block = block;
+  engine.step = 0;
+  engine.end = block->step_events;
+  engine.n = profile->n_start;
+  engine.c = profile->c_start;
+  engine.c_frac = 0;
+  engine.multi_left = 0;
+  engine.multi_extra = 0;
+  engine.scurve.left = 0;
+  if ( (profile->ramp == _SCurve) && (profile->accel_steps != 0) )
+  {
+    SCurveStart(profile->entry_rate, profile->peak_rate, profile->accel_steps);
+  }
+  engine.wait = PeriodToTicks(engine.c, 1);
+  return block;
+}
 
-static StMotor_HandleTypeDef X_driver;   // X-axis driver's handler
-void TIM1_BRK_TIM9_IRQHandler(void)
+/**
+  * @brief Calculate the slot specified.
+  * The period of the previous slot is known only now, so it's set here too.
+  */
+static void CalcSlot(uint32_t slot)
 {
-  __HAL_TIM_CLEAR_FLAG(&X_driver.htim, TIM_FLAG_CC1);
-  X_driver.angle += X_driver.dir;
-  if (X_driver.angle == X_driver.set_angle)
+  StMotor_BlockTypeDef* block = engine.block;
+  uint32_t ticks;   // Period of the previous slot
+  for (uint8_t i = 0; i < ports_amount; i++)
+  {
+    slot_bsrr[i][slot] = 0;
+  }
+  for (uint8_t i = 0; i < AXIS_AMOUNT; i++)
+  {
+    slot_delta[slot][i] = 0;
+  }
+  slot_move[slot] = engine.done;
+
+  if (block == NULL) block = LoadBlock();
+  if (block == NULL)
+  {
+    ticks = (uint64_t)MOTOR_IDLE_PERIOD*TIM_FRQ/1000000;
+  }
+  else if (engine.wait > TIM_MAX_PERIOD)
+  {
+    // Split the long period, the rest is still longer than a half.
+    ticks = TIM_MAX_PERIOD/2;
+    engine.wait -= ticks;
+  }
+  else if (engine.turn)
   {
-    StopMotor(_X);
+    ticks = engine.wait - engine.dir_setup;
+    engine.wait = engine.dir_setup;
+    engine.turn = 0;
+    for (uint8_t i = 0; i < ports_amount; i++)
+    {
+      slot_bsrr[i][slot] = block->dir_bsrr[i];
+    }
   }
+  else
+  {
+    ticks = engine.wait;
+    // Distribute the steps of all axises over the step events.
+    for (uint8_t i = 0; i < AXIS_AMOUNT; i++)
+    {
+      StMotor_HandleTypeDef* driver = &drivers[i];
+      driver->counter += block->steps[i];
+      if (driver->counter > 0)
+      {
+        driver->counter -= block->step_events;
+        driver->left--;
+        if (IsHalted(i, engine.move))
+        {
+          engine.carry[i] += driver->dir;
+          continue;
+        }
+        slot_bsrr[driver->step_port_id][slot] |= driver->step_pin;
+        slot_delta[slot][i] = driver->dir;
+        engine.delta[slot/(MOTOR_SLOTS/2)][i] += driver->dir;
+      }
+    }
+    engine.steps[slot/(MOTOR_SLOTS/2)] = 1;
+    engine.step++;
+    if (engine.step != engine.end)
+    {
+      engine.wait = NextStep();
+    }
+    else
+    {
+      CarryLeft();
+      engine.done += 1 + engine.dropped;
+      engine.dropped = 0;
+      engine.block = NULL;
+    }
+  }
+  slot_arr[engine.slot] = (uint16_t)(ticks - 1);
+  engine.slot = slot;
 }
 
-static StMotor_HandleTypeDef Y_driver;          // Y-axis driver's handler
-void TIM1_TRG_COM_TIM11_IRQHandler(void)
+/**
+  * @brief Put the next step event of the unshaped motion to the history.
+  * The events are calculated as the slots of CalcSlot(), but the turns
+  * and the long periods are left to the output.
+  * Returns 0 if there is nothing to step or no room for the event.
+  */
+static uint8_t ShaperFeed(void)
 {
-  __HAL_TIM_CLEAR_FLAG(&Y_driver.htim, TIM_FLAG_CC1);
-  Y_driver.angle += Y_driver.dir;
-  if (Y_driver.angle == Y_driver.set_angle)
+  StMotor_ShaperTypeDef* shaper = &engine.shaper;
+  if (shaper->head - shaper->read[shaper->taps - 1] == SHAPER_HISTORY) return 0;
+  StMotor_BlockTypeDef* block = engine.block;
+  if (block == NULL) block = LoadBlock();
+  if (block == NULL) return 0;
+  StMotor_EventTypeDef* event = &shaper_history[shaper->head & (SHAPER_HISTORY - 1)];
+  // The motion is delayed if the output has got ahead of it: after
+  // an idle time or if the history was full.
+  uint32_t time = shaper->time + engine.wait;
+  if ((int32_t)(time - shaper->out_time) < 0) time = shaper->out_time;
+  shaper->time = time;
+  event->time = time;
+  event->ends = 0;
+  for (uint8_t i = 0; i < AXIS_AMOUNT; i++)
+  {
+    StMotor_HandleTypeDef* driver = &drivers[i];
+    event->delta[i] = 0;
+    driver->counter += block->steps[i];
+    if (driver->counter > 0)
+    {
+      driver->counter -= block->step_events;
+      driver->left--;
+      if (IsHalted(i, engine.move))
+      {
+        engine.carry[i] += driver->dir;
+        continue;
+      }
+      event->delta[i] = driver->dir;
+    }
+  }
+  engine.step++;
+  if (engine.step != engine.end)
+  {
+    engine.wait = NextStep();
+  }
+  else
   {
-    StopMotor(_Y);
+    CarryLeft();
+    event->ends = 1 + engine.dropped;
+    engine.dropped = 0;
+    engine.block = NULL;
   }
+  shaper->head++;
+  return 1;
 }
 
-static StMotor_HandleTypeDef Z_driver;          // Z-axis driver's handler
-void TIM1_UP_TIM10_IRQHandler(void)
+/**
+  * @brief Check whether the shaped position has fallen behind the output
+  * by half a step or more
+  */
+static uint8_t ShaperLags(void)
 {
-  __HAL_TIM_CLEAR_FLAG(&Z_driver.htim, TIM_FLAG_CC1);
-  Z_driver.angle += Z_driver.dir;
-  if (Z_driver.angle == Z_driver.set_angle)
+  for (uint8_t i = 0; i < AXIS_AMOUNT; i++)
   {
-    StopMotor(_Z);
+    int32_t rest = engine.shaper.rest[i];
+    if ( (rest >= (1 << (SHAPER_AMP_SHIFT - 1))) || (rest < -(1 << (SHAPER_AMP_SHIFT - 1))) ) return 1;
   }
+  return 0;
 }
 
-static void InitIRQ(void)
+/**
+  * @brief Calculate the next output event of the shaper.
+  * The event is at the earliest event of the history delayed by its
+  * impulse, but not closer to the last slot than a turn takes. All the
+  * delayed events up to the end of that time are summed up, and every axis
+  * is stepped toward the shaped position if it's half a step away.
+  * Returns 0 if there is nothing to step.
+  */
+static uint8_t ShaperNext(void)
 {
-  // X-axis
-  HAL_NVIC_SetPriority(TIM1_BRK_TIM9_IRQn, ANGLE_IRQ_PR_PRIORITY, ANGLE_IRQ_SUB_PRIORITY);
-  HAL_NVIC_EnableIRQ(TIM1_BRK_TIM9_IRQn);
+  StMotor_ShaperTypeDef* shaper = &engine.shaper;
+  uint32_t window = engine.pulse + engine.dir_setup + 1;
+  for (;;)
+  {
+    if (shaper->read[0] == shaper->head) ShaperFeed();
+    uint8_t found = 0;
+    uint32_t time = 0;
+    for (uint8_t k = 0; k < shaper->taps; k++)
+    {
+      if (shaper->read[k] == shaper->head) continue;
+      uint32_t t = shaper_history[shaper->read[k] & (SHAPER_HISTORY - 1)].time + shaper->impulse[k].delay;
+      if ( !found || ((int32_t)(t - time) < 0) ) time = t;
+      found = 1;
+    }
+    if ( !found && !ShaperLags() )
+    {
+      engine.done += shaper->ends;
+      shaper->ends = 0;
+      return 0;
+    }
+    if ( !found || ((int32_t)(time - (shaper->out_time + window)) < 0) ) time = shaper->out_time + window;
 
-  // Y-axis
-  HAL_NVIC_SetPriority(TIM1_TRG_COM_TIM11_IRQn, ANGLE_IRQ_PR_PRIORITY, ANGLE_IRQ_SUB_PRIORITY);
-  HAL_NVIC_EnableIRQ(TIM1_TRG_COM_TIM11_IRQn);
+    for (uint8_t k = 0; k < shaper->taps; k++)
+    {
+      for (;;)
+      {
+        if ( (shaper->read[k] == shaper->head) && ((k != 0) || !ShaperFeed()) ) break;
+        StMotor_EventTypeDef* event = &shaper_history[shaper->read[k] & (SHAPER_HISTORY - 1)];
+        if ((int32_t)(event->time + shaper->impulse[k].delay - time) >= (int32_t)window) break;
+        for (uint8_t i = 0; i < AXIS_AMOUNT; i++)
+        {
+          shaper->rest[i] += shaper->impulse[k].amp*event->delta[i];
+        }
+        if (k == shaper->taps - 1) shaper->ends += event->ends;
+        shaper->read[k]++;
+      }
+    }
 
-  // Z-axis
-  HAL_NVIC_SetPriority(TIM1_UP_TIM10_IRQn, ANGLE_IRQ_PR_PRIORITY, ANGLE_IRQ_SUB_PRIORITY);
-  HAL_NVIC_EnableIRQ(TIM1_UP_TIM10_IRQn);
+    uint8_t stepped = 0;
+    shaper->turn = 0;
+    for (uint8_t i = 0; i < MOTOR_PORTS; i++)
+    {
+      shaper->ev_dir_bsrr[i] = 0;
+    }
+    for (uint8_t i = 0; i < AXIS_AMOUNT; i++)
+    {
+      StMotor_HandleTypeDef* driver = &drivers[i];
+      int8_t step = 0;
+      shaper->ev_delta[i] = 0;
+      if (shaper->rest[i] >= (1 << (SHAPER_AMP_SHIFT - 1))) step = 1;
+      else if (shaper->rest[i] < -(1 << (SHAPER_AMP_SHIFT - 1))) step = -1;
+      else continue;
+      shaper->rest[i] -= step*(1 << SHAPER_AMP_SHIFT);
+      if (step != shaper->dir[i])
+      {
+        shaper->dir[i] = step;
+        shaper->turn = 1;
+        shaper->ev_dir_bsrr[driver->dir_port_id] |= (step > 0) ? driver->dir_pin : driver->dir_pin << 16;
+      }
+      shaper->ev_delta[i] = step;
+      stepped = 1;
+    }
+    if (stepped)
+    {
+      shaper->ev_time = time;
+      return 1;
+    }
+  }
 }
 
-static Error InitOutput(StMotor_HandleTypeDef *driver, TIM_TypeDef *timer)
+/**
+  * @brief Check whether the shaper has nothing to output
+  */
+static uint8_t IsShaperIdle(void)
 {
-  driver->htim.Instance = timer;
-  driver->htim.Init.CounterMode = TIM_COUNTERMODE_UP;
-  driver->htim.Init.ClockDivision = TIM_CLOCKDIVISION_DIV1;
-  if (HAL_TIM_Base_Init(&driver->htim) != HAL_OK) return _HALError;
-
-  driver->sConfigOC.OCMode = TIM_OCMODE_PWM1;
-  driver->sConfigOC.OCPolarity = TIM_OCPOLARITY_HIGH;
-  driver->sConfigOC.OCFastMode = TIM_OCFAST_DISABLE;
+  StMotor_ShaperTypeDef* shaper = &engine.shaper;
+  if (shaper->taps == 0) return 1;
+  return !shaper->pending && (shaper->read[shaper->taps - 1] == shaper->head) && !ShaperLags();
+}
 
-  if (HAL_TIM_PWM_ConfigChannel(&driver->htim, &driver->sConfigOC, TIM_CHANNEL_1)
-      != HAL_OK) return _HALError;
-  if (HAL_TIM_PWM_Init(&driver->htim) != HAL_OK) return _HALError;
+/**
+  * @brief Calculate the slot specified from the output events of the shaper.
+  * The same as CalcSlot(), but the slots are at the times of the events.
+  */
+static void CalcShapedSlot(uint32_t slot)
+{
+  StMotor_ShaperTypeDef* shaper = &engine.shaper;
+  uint32_t ticks;   // Period of the previous slot
+  for (uint8_t i = 0; i < ports_amount; i++)
+  {
+    slot_bsrr[i][slot] = 0;
+  }
+  for (uint8_t i = 0; i < AXIS_AMOUNT; i++)
+  {
+    slot_delta[slot][i] = 0;
+  }
+  slot_move[slot] = engine.done;
 
-  return _Success;
+  if (!shaper->pending) shaper->pending = ShaperNext();
+  if (!shaper->pending)
+  {
+    ticks = (uint64_t)MOTOR_IDLE_PERIOD*TIM_FRQ/1000000;
+  }
+  else
+  {
+    // The directions are changed dir_setup ahead of the steps.
+    ticks = shaper->ev_time - shaper->out_time - (shaper->turn ? engine.dir_setup : 0);
+    if (ticks > TIM_MAX_PERIOD)
+    {
+      ticks = TIM_MAX_PERIOD/2;
+    }
+    else if (shaper->turn)
+    {
+      shaper->turn = 0;
+      for (uint8_t i = 0; i < ports_amount; i++)
+      {
+        slot_bsrr[i][slot] = shaper->ev_dir_bsrr[i];
+      }
+    }
+    else
+    {
+      for (uint8_t i = 0; i < AXIS_AMOUNT; i++)
+      {
+        StMotor_HandleTypeDef* driver = &drivers[i];
+        if (shaper->ev_delta[i] == 0) continue;
+        slot_bsrr[driver->step_port_id][slot] |= driver->step_pin;
+        slot_delta[slot][i] = shaper->ev_delta[i];
+        engine.delta[slot/(MOTOR_SLOTS/2)][i] += shaper->ev_delta[i];
+      }
+      engine.steps[slot/(MOTOR_SLOTS/2)] = 1;
+      engine.done += shaper->ends;
+      shaper->ends = 0;
+      shaper->pending = 0;
+    }
+  }
+  shaper->out_time += ticks;
+  slot_arr[engine.slot] = (uint16_t)(ticks - 1);
+  engine.slot = slot;
 }
 
-static void DeInitIRQ(void)
+/**
+  * @brief Start the shaper with the impulses set by MotorSetShaper()
+  */
+static void ShaperStart(void)
 {
-  // X-axis
-  HAL_NVIC_DisableIRQ(TIM1_BRK_TIM9_IRQn);
+  StMotor_ShaperTypeDef* shaper = &engine.shaper;
+  shaper->taps = queue_taps;
+  for (uint8_t k = 0; k < SHAPER_TAPS; k++)
+  {
+    shaper->impulse[k] = queue_impulse[k];
+    shaper->read[k] = 0;
+  }
+  shaper->head = 0;
+  shaper->time = 0;
+  shaper->out_time = 0;
+  shaper->ends = 0;
+  shaper->pending = 0;
+  shaper->turn = 0;
+  for (uint8_t i = 0; i < AXIS_AMOUNT; i++)
+  {
+    shaper->rest[i] = 0;
+    shaper->dir[i] = drivers[i].dir;
+  }
+}
 
-  //Y-axis
-  HAL_NVIC_DisableIRQ(TIM1_TRG_COM_TIM11_IRQn);
+/**
+  * @brief Stop the shaper, the direction outputs are the ones it has set
+  */
+static void ShaperStop(void)
+{
+  if (engine.shaper.taps == 0) return;
+  for (uint8_t i = 0; i < AXIS_AMOUNT; i++)
+  {
+    drivers[i].dir = engine.shaper.dir[i];
+  }
+}
 
-  //Z-axis
-  HAL_NVIC_DisableIRQ(TIM1_UP_TIM10_IRQn);
+/**
+  * @brief Replace the rest of the motion with the deceleration to
+  * MOTOR_START_RATE. The move being calculated is decelerated with MOTOR_ACCEL
+  * from the next step on, it's cut short or extended along its line to do
+  * that. The moves not started are dropped, they are finished with it.
+  * The ramp starts from the period being output, which is ahead of the ramp
+  * in a group of steps, and the feed rate override is folded into it.
+  */
+static void QuickStopStart(void)
+{
+  engine.stop = 0;
+  // The move ended last may be left at speed, so the next one is stopped.
+  StMotor_BlockTypeDef* block = engine.block;
+  if (block == NULL) block = LoadBlock();
+  engine.dropped = (uint8_t)(queue_head - engine.next);
+  engine.next = queue_head;
+  if (block == NULL) return;
+  StMotor_ProfileTypeDef* profile = &block->profile;
+  engine.c = engine.period;
+  engine.feed_scale = 1 << FEED_SHIFT;
+  uint32_t rate = (uint32_t)(((uint64_t)TIM_FRQ << (8 + MOTOR_RATE_SHIFT))/engine.c);
+  uint32_t steps = 0;
+  if (rate > MOTOR_START_RATE)
+  {
+    if (profile->ramp == _SCurve)
+    {
+      steps = SCurveSteps(MOTOR_START_RATE, rate, MOTOR_ACCEL_STEPS);
+      profile->peak_rate = rate;
+      profile->exit_rate = MOTOR_START_RATE;
+    }
+    else
+    {
+      engine.n = RateToRampStep(rate, MOTOR_ACCEL_STEPS);
+      steps = engine.n - RateToRampStep(MOTOR_START_RATE, MOTOR_ACCEL_STEPS);
+      profile->c_end = (uint32_t)(((uint64_t)TIM_FRQ << (8 + MOTOR_RATE_SHIFT))/MOTOR_START_RATE);
+    }
+  }
+  profile->accel_steps = 0;
+  profile->decel_start = engine.step + 1;
+  engine.end = engine.step + 1 + steps;
+  // The ramp of the group being stepped is replaced as well.
+  engine.multi_left = 0;
+  engine.multi_extra = 0;
 }
 
-static Error DeInitOutput(StMotor_HandleTypeDef *driver)
+/**
+  * @brief Calculate the slots of the half of the table specified
+  */
+static void FillHalf(uint32_t half)
 {
-  if (HAL_TIM_Base_DeInit(&driver->htim) != HAL_OK) return _HALError;
-  if (HAL_TIM_PWM_DeInit(&driver->htim) != HAL_OK) return _HALError;
-  return _Success;
+  engine.steps[half] = 0;
+  for (uint8_t i = 0; i < AXIS_AMOUNT; i++)
+  {
+    engine.delta[half][i] = 0;
+  }
+  if (engine.stop) QuickStopStart();
+  for (uint32_t slot = half*(MOTOR_SLOTS/2); slot < (half + 1)*(MOTOR_SLOTS/2); slot++)
+  {
+    if (engine.shaper.taps != 0) CalcShapedSlot(slot);
+    else CalcSlot(slot);
+  }
+  engine.tail[half] = engine.done;
 }
 
-static Error MotorStart(StMotor_HandleTypeDef* driver)
+/**
+  * @brief Calculate the table and start the engine.
+  * Called by the task when the queue is idle.
+  */
+static void EngineStart(void)
 {
-  if (HAL_TIM_PWM_Start_IT(&driver->htim, TIM_CHANNEL_1) != HAL_OK) return _HALError;
-  driver->busy = 1;
-  return _Success;
+  // The period before the first slot is put to the last one, it's rewritten
+  // before DMA gets there.
+  PositionWriteBegin();
+  engine.slot = MOTOR_SLOTS - 1;
+  engine.half = 0;
+  engine.feed_scale = feed_target;  // The motors are at rest, no need to ramp
+  engine.multi = 1;
+  ShaperStart();
+  FillHalf(0);
+  FillHalf(1);
+  queue_running = 1;
+
+  ReleaseStreams();
+  __HAL_DMA_CLEAR_FLAG(&engine.hdma, __HAL_DMA_GET_HT_FLAG_INDEX(&engine.hdma) |
+                                     __HAL_DMA_GET_TC_FLAG_INDEX(&engine.hdma) |
+                                     __HAL_DMA_GET_TE_FLAG_INDEX(&engine.hdma));
+  HAL_DMA_Start(&engine.hdma, (uint32_t)slot_arr, (uint32_t)&engine.htim.Instance->ARR, MOTOR_SLOTS);
+  __HAL_DMA_ENABLE_IT(&engine.hdma, DMA_IT_HT | DMA_IT_TC);
+  uint32_t requests = TIM_DMA_UPDATE;
+  for (uint8_t i = 0; i < ports_amount; i++)
+  {
+    HAL_DMA_Start(&engine.hdma_set[i], (uint32_t)slot_bsrr[i], (uint32_t)&ports[i].port->BSRR, MOTOR_SLOTS);
+    HAL_DMA_Start(&engine.hdma_reset[i], (uint32_t)&ports[i].reset, (uint32_t)&ports[i].port->BSRR, 1);
+    requests |= port_dma[i].set_request | port_dma[i].reset_request;
+  }
+  // Start past the compare values, so the outputs are written by the
+  // update events only.
+  engine.htim.Instance->CNT = engine.pulse + 1;
+  engine.htim.Instance->ARR = slot_arr[MOTOR_SLOTS - 1];
+  __HAL_TIM_ENABLE_DMA(&engine.htim, requests);
+  __HAL_TIM_ENABLE(&engine.htim);
+  PositionWriteEnd();
 }
 
-static Error MotorStop(StMotor_HandleTypeDef* driver)
+/**
+  * @brief Stop the timer and DMA.
+  * The streams are disabled without waiting for their last transfer, since
+  * it's called by the DMA IRQ handler. EngineStart() waits for them.
+  */
+static void EngineStop(void)
 {
-  if (HAL_TIM_PWM_Stop_IT(&driver->htim, TIM_CHANNEL_1) != HAL_OK) return _HALError;
-  __HAL_TIM_CLEAR_FLAG(&driver->htim, TIM_FLAG_CC1);
-  driver->busy = 0;
-  return _Success;
+  __HAL_TIM_DISABLE(&engine.htim);
+  __HAL_TIM_DISABLE_DMA(&engine.htim, TIM_DMA_UPDATE);
+  __HAL_DMA_DISABLE(&engine.hdma);
+  for (uint8_t i = 0; i < ports_amount; i++)
+  {
+    __HAL_TIM_DISABLE_DMA(&engine.htim, port_dma[i].set_request | port_dma[i].reset_request);
+    __HAL_DMA_DISABLE(&engine.hdma_set[i]);
+    __HAL_DMA_DISABLE(&engine.hdma_reset[i]);
+  }
 }
 
-static Error SetSpeedAndValue(StMotor_HandleTypeDef* driver, double rpm, double angle)
+/**
+  * @brief Wait for the streams disabled by EngineStop() and release their
+  * handles, so they can be started or deinitialized. Called by the task,
+  * the last transfers are over long ago then.
+  */
+static void ReleaseStreams(void)
 {
-  if (rpm < 0)
+  HAL_DMA_Abort(&engine.hdma);
+  for (uint8_t i = 0; i < ports_amount; i++)
   {
-    return _OutOfRange;
+    HAL_DMA_Abort(&engine.hdma_set[i]);
+    HAL_DMA_Abort(&engine.hdma_reset[i]);
   }
-  Error err = _Success;
-  driver->set_angle = (int32_t)(angle*MOTOR_STEP_DIV/MOTOR_STEP_DG);
-  if (driver->set_angle - driver->angle < 0)
+}
+
+/**
+  * @brief Get the angles being executed, in steps.
+  * The steps of the half being executed are summed up to the slot DMA
+  * is at. Must be called with the position not being updated.
+  */
+static void GetSteps(int64_t angle[AXIS_AMOUNT])
+{
+  for (uint8_t i = 0; i < AXIS_AMOUNT; i++)
   {
-    driver->dir = -1;
+    angle[i] = drivers[i].angle;
   }
-  else if (driver->set_angle - driver->angle > 0)
+  if (queue_running)
   {
-    driver->dir = 1;
-  } else if (rpm == 0)
+    uint32_t first = engine.half*(MOTOR_SLOTS/2);
+    uint32_t done = (MOTOR_SLOTS - __HAL_DMA_GET_COUNTER(&engine.hdma)) & (MOTOR_SLOTS - 1);
+    for (uint32_t slot = first; slot != done; slot = (slot + 1) & (MOTOR_SLOTS - 1))
+    {
+      for (uint8_t i = 0; i < AXIS_AMOUNT; i++)
+      {
+        angle[i] += slot_delta[slot][i];
+      }
+    }
+  }
+}
+
+/**
+  * @brief Take a consistent snapshot of the angles being executed, in steps.
+  * The IRQs aren't disabled: the angles are read again if the refill IRQ
+  * or a task has updated them meanwhile.
+  */
+static void GetPosition(int64_t angle[AXIS_AMOUNT])
+{
+  uint32_t seq;
+  do
   {
-    return _Success;  // We don't need to move
-  } else
+    seq = engine.seq;
+    __DMB();
+    GetSteps(angle);
+    __DMB();
+  } while ( (seq & 1) || (seq != engine.seq) );
+}
+
+/**
+  * @brief Continue from the actual position if the queue is idle
+  */
+static void QueueSync(void)
+{
+  if (!queue_running)
   {
-    return _IncompatibleArgs;
+    for (uint8_t i = 0; i < AXIS_AMOUNT; i++)
+    {
+      queue_angle[i] = drivers[i].angle;
+    }
   }
-  if (rpm == 0)
+}
+
+/**
+  * @brief Put a move to the queue.
+  * target is the angle of every axis at the end of the move, in steps.
+  * The rates are the ones of the fastest axis.
+  */
+static Error QueueBlock(const int64_t target[AXIS_AMOUNT],
+                        uint32_t rate, uint32_t entry_rate, uint32_t exit_rate)
+{
+  if (MotorQueueGetFree() == 0) return _QueueFull;
+  StMotor_BlockTypeDef* block = &queue[queue_head & (MOTOR_QUEUE_SIZE - 1)];
+  block->step_events = 0;
+  for (uint8_t i = 0; i < AXIS_AMOUNT; i++)
   {
-    return _IncompatibleArgs;
+    int64_t delta = target[i] - queue_angle[i];
+    block->dir[i] = (delta < 0) ? -1 : 1;
+    block->steps[i] = (uint32_t)((delta < 0) ? -delta : delta);
+    if (block->steps[i] > block->step_events) block->step_events = block->steps[i];
   }
-  uint32_t prsc = (uint32_t)(RPM_PRSC_POINT/rpm);
-  if (prsc > 0xffff) prsc = 0xffff;
-  uint32_t frq = (uint32_t)(TIM_CLK*1000000*MOTOR_STEP_DG/(6*rpm*MOTOR_STEP_DIV*(prsc+1)));
-  if ( (frq <= 0) || (frq > 0xffff) )
+  if (block->step_events == 0) return _Success;  // We don't need to move
+  if (rate == 0) return _IncompatibleArgs;
+  for (uint8_t i = 0; i < MOTOR_PORTS; i++)
   {
-    return _OutOfRange;
+    block->dir_bsrr[i] = 0;
   }
-  driver->htim.Init.Prescaler = prsc;
-  driver->htim.Init.Period = (uint16_t)frq;
-  driver->sConfigOC.Pulse = (uint16_t)(frq/2);
-  if (driver == &X_driver)
+  for (uint8_t i = 0; i < AXIS_AMOUNT; i++)
   {
-    HAL_GPIO_WritePin(GPIOA, GPIO_PIN_1, (GPIO_PinState)(driver->dir + 1));
+    if (block->steps[i] == 0) continue;  // Keep the direction of an idle axis
+    uint32_t pin = drivers[i].dir_pin;
+    block->dir_bsrr[drivers[i].dir_port_id] |= (block->dir[i] > 0) ? pin : pin << 16;
   }
-  if (driver == &Y_driver)
+  // The move is sped up no more than by the override applied now, and the
+  // scale of the queued moves follows it down not faster than MOTOR_ACCEL.
+  // The limits of the motors are scaled down by the same override, so the
+  // output speeds stay within them.
+  uint32_t floor = feed_target;
+  if (queue_running && (engine.feed_scale < floor)) floor = engine.feed_scale;
+  if (floor > (1 << FEED_SHIFT)) floor = 1 << FEED_SHIFT;
+  uint32_t accel = (uint32_t)((uint64_t)MOTOR_ACCEL_STEPS*floor*floor >> (2*FEED_SHIFT));
+  uint32_t max_rate = (uint32_t)((uint64_t)MOTOR_MAX_RATE*floor >> FEED_SHIFT);
+  uint32_t start_rate = (uint32_t)((uint64_t)MOTOR_START_RATE*floor >> FEED_SHIFT);
+  if ( (floor < (1 << FEED_SHIFT)) && (rate > max_rate) ) rate = max_rate;
+  block->feed_floor = floor;
+  Error err = ComputeProfile(queue_ramp, rate, entry_rate, exit_rate, start_rate,
+                             block->step_events, accel, &block->profile);
+  if (err != _Success) return err;
+  // MotorHaltAxis() mustn't see the engine half started, and MotorQuickStop()
+  // mustn't drop the moves before the move is queued.
+  taskENTER_CRITICAL();
+  if (queue_stopping)
   {
-    HAL_GPIO_WritePin(GPIOA, GPIO_PIN_4, (GPIO_PinState)(driver->dir + 1));
+    taskEXIT_CRITICAL();
+    return _Aborted;
   }
-  if (driver == &Z_driver)
+  for (uint8_t i = 0; i < AXIS_AMOUNT; i++)
   {
-    HAL_GPIO_WritePin(GPIOA, GPIO_PIN_7, (GPIO_PinState)(driver->dir + 1));
+    queue_angle[i] = target[i];
+    if (block->steps[i] != 0) queue_axis_last[i] = queue_head;
   }
-  driver->htim.Instance->PSC = driver->htim.Init.Prescaler;
-  driver->htim.Instance->ARR = driver->htim.Init.Period;
-  driver->htim.Instance->CCR1 = driver->sConfigOC.Pulse;
-  if (HAL_TIM_PWM_Start_IT(&driver->htim, TIM_CHANNEL_1) != HAL_OK) return _HALError;
-  driver->busy = 1;
-  if (err != _Success) return err;
+  __DMB();  // The block must be completely written before the IRQ handler can see it
+  queue_head++;
+  if (!queue_running) EngineStart();
+  taskEXIT_CRITICAL();
   return _Success;
 }
 
 /* Public functions */
 Error SMotorDriversInit()
 {
+  Error err = InitPorts();
+  if (err != _Success) return err;
   InitIRQ();
-  Error err;
-  err = InitOutput(&X_driver, TIM9);
-  if (err != _Success) goto e;
-  err = InitOutput(&Y_driver, TIM11);
-  if (err != _Success) goto e;
-  err = InitOutput(&Z_driver, TIM10);
-  if (err != _Success) goto e;
-  return _Success;
-  e:
-  return err;
+  return InitOutput(&engine, MOTOR_TIM);
 }
 
 Error SMotorDriversDeInit()
 {
   DeInitIRQ();
-  Error err;
-  err = DeInitOutput(&X_driver);
-  if (err != _Success) goto e;
-  err = DeInitOutput(&Y_driver);
-  if (err != _Success) goto e;
-  err = DeInitOutput(&Z_driver);
-  if (err != _Success) goto e;
-  return _Success;
-  e:
-  return err;
+  return DeInitOutput(&engine);
 }
 
 Error EnableMotor(Axis axis)
@@ -256,69 +1727,430 @@ Error DisableMotor(Axis axis)
   return _Success;
 }
 
-Error StartMotor(Axis axis)
+Error StopMotor(Axis axis)
 {
-  switch(axis)
+  if (axis >= AXIS_AMOUNT) return _OutOfRange;
+  // An idle axis is stopped already, the halt mustn't outlast the call.
+  if (!queue_running) return _Success;
+  return MotorHaltAxis(axis);
+}
+
+Error MotorStopAll(void)
+{
+  HAL_NVIC_DisableIRQ(MOTOR_DMA_IRQ);
+  taskENTER_CRITICAL();
+  if (queue_running)
   {
-    case _X: return MotorStart(&X_driver);
-    case _Y: return MotorStart(&Y_driver);
-    case _Z: return MotorStart(&Z_driver);
-    default: return _OutOfRange;
+    PositionWriteBegin();
+    EngineStop();
+    // Keep the steps done, the slots left are dropped.
+    int64_t angle[AXIS_AMOUNT];
+    GetSteps(angle);
+    for (uint8_t i = 0; i < AXIS_AMOUNT; i++)
+    {
+      drivers[i].angle = angle[i];
+    }
+    ShaperStop();
+    queue_running = 0;
+    PositionWriteEnd();
   }
+  ResetStepOutputs();
+  engine.block = NULL;
+  engine.next = queue_head;
+  engine.done = queue_head;
+  queue_tail = queue_head;
+  queue_running = 0;
+  queue_stopping = 0;
+  engine.stop = 0;
+  engine.dropped = 0;
+  ReleaseHalts();
+  taskEXIT_CRITICAL();
+  HAL_NVIC_EnableIRQ(MOTOR_DMA_IRQ);
+  // All queued moves are finished now.
+  HAL_NVIC_SetPendingIRQ(NOTIFY_IRQ);
+  return _Success;
 }
 
-Error StopMotor(Axis axis)
+Error MotorHaltAxis(Axis axis)
 {
-  switch(axis)
+  if (axis >= AXIS_AMOUNT) return _OutOfRange;
+  StMotor_HandleTypeDef* driver = &drivers[axis];
+  // Neither the refill IRQ nor another IRQ halting an axis may come in.
+  uint32_t mask = portSET_INTERRUPT_MASK_FROM_ISR();
+  HAL_NVIC_DisableIRQ(MOTOR_DMA_IRQ);
+  PositionWriteBegin();
+  uint32_t move = CurrentMove();
+  if (move != engine.halt_move) engine.halted = 0;  // The moves halted before are over
+  engine.halt_move = move;
+  engine.halted |= 1 << axis;
+  // Drop the steps of the move in the slots DMA hasn't got to, the angle is
+  // accounted without them. The steps fed to the shaper are still output,
+  // so the shaped axis stops within the shaper duration.
+  if (queue_running && (engine.shaper.taps == 0))
   {
-    case _X: return MotorStop(&X_driver);
-    case _Y: return MotorStop(&Y_driver);
-    case _Z: return MotorStop(&Z_driver);
-    default: return _OutOfRange;
+    uint32_t first = engine.half*(MOTOR_SLOTS/2);
+    uint32_t done = (MOTOR_SLOTS - __HAL_DMA_GET_COUNTER(&engine.hdma)) & (MOTOR_SLOTS - 1);
+    uint32_t left = MOTOR_SLOTS - ((done - first) & (MOTOR_SLOTS - 1));
+    for (uint32_t slot = done; left != 0; slot = (slot + 1) & (MOTOR_SLOTS - 1), left--)
+    {
+      if ( (slot_delta[slot][axis] == 0) || (slot_move[slot] != move) ) continue;
+      slot_bsrr[driver->step_port_id][slot] &= ~(uint32_t)driver->step_pin;
+      engine.delta[slot/(MOTOR_SLOTS/2)][axis] -= slot_delta[slot][axis];
+      engine.carry[axis] += slot_delta[slot][axis];
+      slot_delta[slot][axis] = 0;
+    }
   }
+  // The move is over once all its axises are halted, the rest of its time
+  // isn't waited for.
+  StMotor_BlockTypeDef* block = engine.block;
+  if ( (block != NULL) && (engine.move == move) )
+  {
+    uint8_t moving = 0;
+    for (uint8_t i = 0; i < AXIS_AMOUNT; i++)
+    {
+      if ( (block->steps[i] != 0) && !(engine.halted & (1 << i)) ) moving = 1;
+    }
+    if (!moving) engine.end = engine.step + 1;
+  }
+  PositionWriteEnd();
+  HAL_NVIC_EnableIRQ(MOTOR_DMA_IRQ);
+  portCLEAR_INTERRUPT_MASK_FROM_ISR(mask);
+  return _Success;
+}
+
+Error MotorQuickStop(void)
+{
+  // The refill IRQ mustn't get the queue idle in between.
+  uint32_t mask = portSET_INTERRUPT_MASK_FROM_ISR();
+  HAL_NVIC_DisableIRQ(MOTOR_DMA_IRQ);
+  if (queue_running)
+  {
+    queue_stopping = 1;
+    engine.stop = 1;
+  }
+  HAL_NVIC_EnableIRQ(MOTOR_DMA_IRQ);
+  portCLEAR_INTERRUPT_MASK_FROM_ISR(mask);
+  return _Success;
+}
+
+uint8_t IsMotorStopping(void)
+{
+  return queue_stopping;
+}
+
+uint8_t IsMotorHalted(Axis axis)
+{
+  if (axis >= AXIS_AMOUNT) return 0;
+  return ((engine.halted >> axis) & 1) && !IsMotorMoveDone(engine.halt_move);
 }
 
 Error MotorSetSpeedAndValue(Axis axis, double rpm, double angle)
 {
-  switch(axis)
+  if (axis >= AXIS_AMOUNT) return _OutOfRange;
+  if (rpm < 0) return _OutOfRange;
+  QueueSync();
+  int64_t target[AXIS_AMOUNT];
+  for (uint8_t i = 0; i < AXIS_AMOUNT; i++)
   {
-    case _X: return SetSpeedAndValue(&X_driver, rpm, angle);
-    case _Y: return SetSpeedAndValue(&Y_driver, rpm, angle);
-    case _Z: return SetSpeedAndValue(&Z_driver, rpm, angle);
-    default: return _OutOfRange;
+    target[i] = queue_angle[i];
   }
+  target[axis] = AngleToSteps(angle);
+  return QueueBlock(target, (uint32_t)(rpm*RATE_PER_RPM), 0, 0);
 }
 
 Error ZeroOutAngleCounter(Axis axis)
 {
-  switch(axis)
+  if (axis >= AXIS_AMOUNT) return _OutOfRange;
+  int64_t angle[AXIS_AMOUNT];
+  HAL_NVIC_DisableIRQ(MOTOR_DMA_IRQ);
+  taskENTER_CRITICAL();
+  GetSteps(angle);
+  PositionWriteBegin();
+  drivers[axis].angle -= angle[axis];
+  PositionWriteEnd();
+  taskEXIT_CRITICAL();
+  HAL_NVIC_EnableIRQ(MOTOR_DMA_IRQ);
+  return _Success;
+}
+
+uint8_t IsMotorBusy(Axis axis)
+{
+  if (axis >= AXIS_AMOUNT) return 0;
+  return (int32_t)(queue_axis_last[axis] - queue_tail) >= 0;
+}
+
+double MotorGetAngle(Axis axis)
+{
+  if (axis >= AXIS_AMOUNT) return 0;
+  int64_t angle[AXIS_AMOUNT];
+  GetPosition(angle);
+  return angle[axis]*MOTOR_STEP_DG/MOTOR_STEP_DIV;
+}
+
+void MotorGetSteps(int32_t steps[AXIS_AMOUNT])
+{
+  int64_t angle[AXIS_AMOUNT];
+  GetPosition(angle);
+  for (uint8_t i = 0; i < AXIS_AMOUNT; i++)
   {
-    case _X: X_driver.angle = 0; break;
-    case _Y: Y_driver.angle = 0; break;
-    case _Z: Z_driver.angle = 0; break;
-    default: return _OutOfRange;
+    steps[i] = (int32_t)angle[i];
+  }
+}
+
+Error MotorQueueMove(const double rpm[AXIS_AMOUNT], const double angle[AXIS_AMOUNT])
+{
+  return MotorQueueMoveEx(rpm, angle, 0, 0);
+}
+
+Error MotorQueueMoveEx(const double rpm[AXIS_AMOUNT], const double angle[AXIS_AMOUNT],
+                       double entry, double exit)
+{
+  if ( (entry < 0) || (entry > 1) || (exit < 0) || (exit > 1) ) return _OutOfRange;
+  QueueSync();
+  int64_t target[AXIS_AMOUNT];
+  uint8_t fastest = 0;
+  int64_t steps = 0;
+  for (uint8_t i = 0; i < AXIS_AMOUNT; i++)
+  {
+    target[i] = AngleToSteps(angle[i]);
+    int64_t delta = target[i] - queue_angle[i];
+    if (delta < 0) delta = -delta;
+    if (delta > steps)
+    {
+      steps = delta;
+      fastest = i;
+    }
+  }
+  if (rpm[fastest] < 0) return _OutOfRange;
+  uint32_t rate = (uint32_t)(rpm[fastest]*RATE_PER_RPM);
+  return QueueBlock(target, rate, (uint32_t)(entry*rate), (uint32_t)(exit*rate));
+}
+
+Error MotorQueueMoveRate(const int32_t target[AXIS_AMOUNT],
+                         uint32_t rate, uint32_t entry_rate, uint32_t exit_rate)
+{
+  QueueSync();
+  int64_t steps[AXIS_AMOUNT];
+  for (uint8_t i = 0; i < AXIS_AMOUNT; i++)
+  {
+    steps[i] = target[i];
   }
+  return QueueBlock(steps, rate, entry_rate, exit_rate);
+}
+
+Error MotorSetRamp(Ramp ramp)
+{
+  if ( (ramp != _Trapezoidal) && (ramp != _SCurve) ) return _OutOfRange;
+  queue_ramp = ramp;
   return _Success;
 }
 
-uint8_t IsMotorBusy(Axis axis)
+Error MotorSetShaper(Shaper shaper, float freq, float damping)
 {
-  switch(axis)
+  float amp[SHAPER_TAPS];
+  float time[SHAPER_TAPS];
+  uint8_t taps;
+  if (shaper == _NoShaper)
   {
-    case _X: return X_driver.busy;
-    case _Y: return Y_driver.busy;
-    case _Z: return Z_driver.busy;
-    default: return _OutOfRange;
+    taps = 0;
+  }
+  else
+  {
+    if ( !(freq >= SHAPER_MIN_FREQ) || !(freq <= SHAPER_MAX_FREQ) ) return _OutOfRange;
+    if ( !(damping >= 0) || !(damping < 1) ) return _OutOfRange;
+    float df = sqrtf(1 - damping*damping);
+    float period = 1/(freq*df);  // Period of the damped vibration, s
+    float k = expf(-damping*SHAPER_PI/df);
+    switch (shaper)
+    {
+      case _ZV:
+        taps = 2;
+        amp[0] = 1;
+        amp[1] = k;
+        time[0] = 0;
+        time[1] = 0.5f*period;
+        break;
+      case _MZV:
+        k = expf(-0.75f*damping*SHAPER_PI/df);
+        taps = 3;
+        amp[0] = 1 - 1/sqrtf(2);
+        amp[1] = (sqrtf(2) - 1)*k;
+        amp[2] = amp[0]*k*k;
+        time[0] = 0;
+        time[1] = 0.375f*period;
+        time[2] = 0.75f*period;
+        break;
+      case _EI:
+        taps = 3;
+        amp[0] = 0.25f*(1 + SHAPER_EI_VTOL);
+        amp[1] = 0.5f*(1 - SHAPER_EI_VTOL)*k;
+        amp[2] = amp[0]*k*k;
+        time[0] = 0;
+        time[1] = 0.5f*period;
+        time[2] = period;
+        break;
+      default:
+        return _OutOfRange;
+    }
+  }
+  // The amplitudes sum up to 1 exactly, so the moves end at their targets.
+  float sum = 0;
+  for (uint8_t k = 0; k < taps; k++)
+  {
+    sum += amp[k];
+  }
+  int32_t left = 1 << SHAPER_AMP_SHIFT;
+  taskENTER_CRITICAL();
+  for (uint8_t k = 0; k < taps; k++)
+  {
+    queue_impulse[k].delay = (uint32_t)(time[k]*TIM_FRQ + 0.5f);
+    queue_impulse[k].amp = (k == taps - 1) ? left : (int32_t)(amp[k]/sum*(1 << SHAPER_AMP_SHIFT) + 0.5f);
+    left -= queue_impulse[k].amp;
   }
+  queue_taps = taps;
+  taskEXIT_CRITICAL();
+  return _Success;
 }
 
-double MotorGetAngle(Axis axis)
+Error MotorSetFeedRate(uint32_t percent)
 {
-  switch(axis)
+  if ( (percent < FEED_MIN) || (percent > FEED_MAX) ) return _OutOfRange;
+  feed_percent = percent;
+  feed_target = (uint32_t)((100 << FEED_SHIFT)/percent);
+  return _Success;
+}
+
+uint32_t MotorGetFeedRate(void)
+{
+  return feed_percent;
+}
+
+int32_t MotorAngleToSteps(float angle)
+{
+  float steps = angle*(float)(MOTOR_STEP_DIV/MOTOR_STEP_DG);
+  return (int32_t)((steps < 0) ? steps - 0.5f : steps + 0.5f);
+}
+
+float MotorStepsToAngle(int32_t steps)
+{
+  return steps*(float)(MOTOR_STEP_DG/MOTOR_STEP_DIV);
+}
+
+uint32_t MotorQueueGetFree(void)
+{
+  return MOTOR_QUEUE_SIZE - (queue_head - queue_tail);
+}
+
+uint8_t IsMotorQueueBusy(void)
+{
+  return queue_running;
+}
+
+uint32_t MotorQueueGetLast(void)
+{
+  return queue_head - 1;
+}
+
+uint32_t MotorQueueGetCurrent(void)
+{
+  uint32_t mask = portSET_INTERRUPT_MASK_FROM_ISR();
+  HAL_NVIC_DisableIRQ(MOTOR_DMA_IRQ);
+  uint32_t move = CurrentMove();
+  HAL_NVIC_EnableIRQ(MOTOR_DMA_IRQ);
+  portCLEAR_INTERRUPT_MASK_FROM_ISR(mask);
+  return move;
+}
+
+uint8_t IsMotorMoveDone(uint32_t move)
+{
+  return (int32_t)(queue_tail - move) > 0;
+}
+
+/**
+  * @brief Take a free waiter entry for the calling task, the notification
+  * IRQ frees the entries too. Returns NULL if there is no free entry.
+  */
+static StMotor_WaiterTypeDef* AddWaiter(uint32_t move, int32_t signal)
+{
+  StMotor_WaiterTypeDef* waiter = NULL;
+  osThreadId thread = osThreadGetId();
+  taskENTER_CRITICAL();
+  for (uint8_t i = 0; i < MOTOR_WAITERS; i++)
+  {
+    if (queue_waiters[i].thread == NULL)
+    {
+      waiter = &queue_waiters[i];
+      waiter->move = move;
+      waiter->signal = signal;
+      waiter->thread = thread;
+      break;
+    }
+  }
+  taskEXIT_CRITICAL();
+  return waiter;
+}
+
+Error MotorWaitMove(uint32_t move, uint32_t millisec)
+{
+  if (IsMotorMoveDone(move)) return _Success;
+  StMotor_WaiterTypeDef* waiter = AddWaiter(move, MOTOR_SIGNAL);
+  if (waiter == NULL) return _QueueFull;
+
+  // A signal left from the previous wait just makes one more iteration,
+  // which waits only for the time left until the deadline.
+  Error err = _Success;
+  osThreadId thread = osThreadGetId();
+  uint32_t start = osKernelSysTick();
+  while (!IsMotorMoveDone(move))
   {
-    case _X: return X_driver.angle*MOTOR_STEP_DG/MOTOR_STEP_DIV;
-    case _Y: return Y_driver.angle*MOTOR_STEP_DG/MOTOR_STEP_DIV;
-    case _Z: return Z_driver.angle*MOTOR_STEP_DG/MOTOR_STEP_DIV;
-    // default: return _OutOfRange;  // TODO: think!
+    uint32_t left = millisec;
+    if (millisec != osWaitForever)
+    {
+      uint32_t spent = (uint64_t)(osKernelSysTick() - start) * 1000 / osKernelSysTickFrequency;
+      left = (spent < millisec) ? millisec - spent : 0;
+    }
+    if ( (left == 0) || (osSignalWait(MOTOR_SIGNAL, left).status == osEventTimeout) )
+    {
+      err = _Timeout;
+      break;
+    }
   }
+  // The notification IRQ might free the entry and give it to another task.
+  taskENTER_CRITICAL();
+  if (waiter->thread == thread) waiter->thread = NULL;
+  taskEXIT_CRITICAL();
+  return err;
+}
+
+Error MotorSignalMove(uint32_t move, int32_t signal)
+{
+  if (AddWaiter(move, signal) == NULL) return _QueueFull;
+  // The move might be finished before the entry is seen by the engine.
+  if (IsMotorMoveDone(move)) HAL_NVIC_SetPendingIRQ(NOTIFY_IRQ);
+  return _Success;
+}
+
+void MotorCancelSignal(void)
+{
+  osThreadId thread = osThreadGetId();
+  taskENTER_CRITICAL();
+  for (uint8_t i = 0; i < MOTOR_WAITERS; i++)
+  {
+    if (queue_waiters[i].thread == thread) queue_waiters[i].thread = NULL;
+  }
+  taskEXIT_CRITICAL();
+}
+
+Error MotorQueueWaitNext(uint32_t millisec)
+{
+  uint32_t move = queue_tail;
+  if (move == queue_head) return _Success;  // The queue is idle
+  return MotorWaitMove(move, millisec);
+}
+
+Error MotorQueueWaitFree(uint32_t millisec)
+{
+  if (MotorQueueGetFree() != 0) return _Success;
+  // The oldest queued move frees its entry when finished.
+  return MotorQueueWaitNext(millisec);
 }
@@ -0,0 +1,52 @@
+/**
+  ******************************************************************************
+  * @file    cmsis_os.h
+  * @brief   Host stand-in of CMSIS-RTOS for the step engine tests.
+  ******************************************************************************
+  * Project: P3D_firmware
+  * Description:
+  * There is the only task, the critical sections are empty and the signals
+  * are never waited for: the tests don't block on the engine.
+  */
+
+#ifndef HOST_CMSIS_OS_H_
+#define HOST_CMSIS_OS_H_
+
+#include "stdint.h"
+#include "stddef.h"
+
+typedef void* osThreadId;
+
+typedef enum
+{
+  osOK = 0,
+  osEventSignal = 0x08,
+  osEventTimeout = 0x40
+} osStatus;
+
+typedef struct
+{
+  osStatus status;
+} osEvent;
+
+#define osWaitForever            0xFFFFFFFF
+#define osKernelSysTickFrequency 1000
+
+#define taskENTER_CRITICAL()
+#define taskEXIT_CRITICAL()
+#define portSET_INTERRUPT_MASK_FROM_ISR()      0u
+#define portCLEAR_INTERRUPT_MASK_FROM_ISR(mask) ((void)(mask))
+
+static inline osThreadId osThreadGetId(void) { return (osThreadId)1; }
+static inline int32_t osSignalSet(osThreadId thread, int32_t signals) { (void)thread; (void)signals; return 0; }
+static inline uint32_t osKernelSysTick(void) { return 0; }
+
+static inline osEvent osSignalWait(int32_t signals, uint32_t millisec)
+{
+  osEvent event = {osEventTimeout};
+  (void)signals;
+  (void)millisec;
+  return event;
+}
+
+#endif
@@ -0,0 +1,166 @@
+/**
+  ******************************************************************************
+  * @file    stm32f4xx_hal.h
+  * @brief   Host stand-in of the HAL for the step engine tests.
+  ******************************************************************************
+  * Project: P3D_firmware
+  * Description:
+  * Declares the registers, constants and calls stepMotor.c uses, so the
+  * engine can be built on the host. The peripherals are plain memory and
+  * the calls do nothing: the tests drive the table refill themselves.
+  */
+
+#ifndef HOST_STM32F4XX_HAL_H_
+#define HOST_STM32F4XX_HAL_H_
+
+#include "stdint.h"
+#include "stddef.h"
+
+typedef enum
+{
+  HAL_OK,
+  HAL_ERROR
+} HAL_StatusTypeDef;
+
+typedef enum
+{
+  DMA2_Stream1_IRQn = 57,
+  TIM1_TRG_COM_TIM11_IRQn = 26
+} IRQn_Type;
+
+typedef struct
+{
+  volatile uint32_t CR1, DIER, CNT, ARR, CCR[4];
+} TIM_TypeDef;
+
+typedef struct
+{
+  volatile uint32_t BSRR;
+} GPIO_TypeDef;
+
+typedef struct
+{
+  volatile uint32_t CR, NDTR, flags;
+} DMA_Stream_TypeDef;
+
+typedef struct
+{
+  uint32_t Prescaler, CounterMode, Period, ClockDivision, RepetitionCounter;
+} TIM_Base_InitTypeDef;
+
+typedef struct
+{
+  TIM_TypeDef* Instance;
+  TIM_Base_InitTypeDef Init;
+} TIM_HandleTypeDef;
+
+typedef struct
+{
+  uint32_t Channel, Direction, PeriphInc, MemInc, PeriphDataAlignment,
+           MemDataAlignment, Mode, Priority, FIFOMode;
+} DMA_InitTypeDef;
+
+typedef struct
+{
+  DMA_Stream_TypeDef* Instance;
+  DMA_InitTypeDef Init;
+} DMA_HandleTypeDef;
+
+typedef enum
+{
+  GPIO_PIN_RESET,
+  GPIO_PIN_SET
+} GPIO_PinState;
+
+static TIM_TypeDef host_tim8;
+static GPIO_TypeDef host_gpioa, host_gpiob;
+static DMA_Stream_TypeDef host_dma2_stream[8];
+
+#define TIM8         (&host_tim8)
+#define GPIOA        (&host_gpioa)
+#define GPIOB        (&host_gpiob)
+#define DMA2_Stream1 (&host_dma2_stream[1])
+#define DMA2_Stream2 (&host_dma2_stream[2])
+#define DMA2_Stream3 (&host_dma2_stream[3])
+#define DMA2_Stream4 (&host_dma2_stream[4])
+#define DMA2_Stream7 (&host_dma2_stream[7])
+
+#define GPIO_PIN_1 0x0002
+#define GPIO_PIN_2 0x0004
+#define GPIO_PIN_3 0x0008
+#define GPIO_PIN_4 0x0010
+#define GPIO_PIN_6 0x0040
+#define GPIO_PIN_7 0x0080
+#define GPIO_PIN_8 0x0100
+#define GPIO_PIN_9 0x0200
+
+#define TIM_COUNTERMODE_UP     0
+#define TIM_CLOCKDIVISION_DIV1 0
+#define TIM_CR1_ARPE           0x0080
+#define TIM_CHANNEL_1          0
+#define TIM_CHANNEL_2          1
+#define TIM_CHANNEL_3          2
+#define TIM_CHANNEL_4          3
+#define TIM_DMA_UPDATE         0x0100
+#define TIM_DMA_CC1            0x0200
+#define TIM_DMA_CC2            0x0400
+#define TIM_DMA_CC3            0x0800
+#define TIM_DMA_CC4            0x1000
+
+#define DMA_CHANNEL_7           7
+#define DMA_MEMORY_TO_PERIPH    1
+#define DMA_PINC_DISABLE        0
+#define DMA_MINC_DISABLE        0
+#define DMA_MINC_ENABLE         1
+#define DMA_PDATAALIGN_HALFWORD 1
+#define DMA_PDATAALIGN_WORD     2
+#define DMA_MDATAALIGN_HALFWORD 1
+#define DMA_MDATAALIGN_WORD     2
+#define DMA_CIRCULAR            1
+#define DMA_PRIORITY_VERY_HIGH  3
+#define DMA_FIFOMODE_DISABLE    0
+#define DMA_IT_HT               0x08
+#define DMA_IT_TC               0x10
+
+#define __DMB()
+
+#define __HAL_TIM_ENABLE(h)          ((h)->Instance->CR1 |= 1)
+#define __HAL_TIM_DISABLE(h)         ((h)->Instance->CR1 &= ~1u)
+#define __HAL_TIM_ENABLE_DMA(h, r)   ((h)->Instance->DIER |= (r))
+#define __HAL_TIM_DISABLE_DMA(h, r)  ((h)->Instance->DIER &= ~(uint32_t)(r))
+#define __HAL_TIM_SET_COMPARE(h, c, v) ((h)->Instance->CCR[c] = (v))
+
+#define __HAL_DMA_GET_HT_FLAG_INDEX(h) 0x1
+#define __HAL_DMA_GET_TC_FLAG_INDEX(h) 0x2
+#define __HAL_DMA_GET_TE_FLAG_INDEX(h) 0x4
+#define __HAL_DMA_GET_FLAG(h, f)       ((h)->Instance->flags & (f))
+#define __HAL_DMA_CLEAR_FLAG(h, f)     ((h)->Instance->flags &= ~(uint32_t)(f))
+#define __HAL_DMA_ENABLE_IT(h, i)      ((h)->Instance->CR |= (i))
+#define __HAL_DMA_DISABLE(h)           ((h)->Instance->CR = 0)
+#define __HAL_DMA_GET_COUNTER(h)       ((h)->Instance->NDTR)
+
+#define HAL_NVIC_SetPriority(irq, pr, sub)  ((void)0)
+#define HAL_NVIC_EnableIRQ(irq)             ((void)0)
+#define HAL_NVIC_DisableIRQ(irq)            ((void)0)
+#define HAL_NVIC_SetPendingIRQ(irq)         ((void)0)
+#define HAL_GPIO_WritePin(port, pin, state) ((void)0)
+
+static inline HAL_StatusTypeDef HAL_TIM_Base_Init(TIM_HandleTypeDef* htim) { (void)htim; return HAL_OK; }
+static inline HAL_StatusTypeDef HAL_TIM_Base_DeInit(TIM_HandleTypeDef* htim) { (void)htim; return HAL_OK; }
+static inline HAL_StatusTypeDef HAL_DMA_Init(DMA_HandleTypeDef* hdma) { (void)hdma; return HAL_OK; }
+static inline HAL_StatusTypeDef HAL_DMA_DeInit(DMA_HandleTypeDef* hdma) { (void)hdma; return HAL_OK; }
+static inline HAL_StatusTypeDef HAL_DMA_Abort(DMA_HandleTypeDef* hdma) { hdma->Instance->CR = 0; return HAL_OK; }
+
+/**
+  * @brief The stream is started at the first slot of the table
+  */
+static inline HAL_StatusTypeDef HAL_DMA_Start(DMA_HandleTypeDef* hdma, uint32_t src, uint32_t dst, uint32_t len)
+{
+  (void)src;
+  (void)dst;
+  hdma->Instance->NDTR = len;
+  hdma->Instance->CR = 1;
+  return HAL_OK;
+}
+
+#endif
@@ -0,0 +1,182 @@
+/**
+  ******************************************************************************
+  * @file    kinematics_test.c
+  * @author  Nikita lazarev <nikitaterm@gmail.com>
+  * @version V1.01
+  * @date    29-May-2016
+  * @brief   Source file of the inverse kinematics tests.
+  ******************************************************************************
+  */
+
+#include "kinematics_test.h"
+
+#include "math.h"
+
+#include "error.h"
+#include "kinematics.h"
+
+/** Specifies the workspace (in mm) being checked.
+  */
+#define WS_X_MIN -30
+#define WS_X_MAX 300
+#define WS_Y_MIN -30
+#define WS_Y_MAX 300
+#define WS_Z_MIN -300
+#define WS_Z_MAX 0
+#define WS_STEP  3  // Isn't a multiple of KIN_LU_STEP to check the interpolation
+
+static Error assertTrue(uint8_t exp)
+{
+  return exp == 1 ? _Success: _UnitTestError;
+}
+
+typedef Error (*KinFunction)(float X, float Y, float Z, float angle[AXIS_AMOUNT]);
+
+/**
+  * @brief This test checks the error of the single precision kinematics
+  * against the double precision reference over the whole workspace.
+  * The points which can't be reached are skipped.
+  */
+static Error TestAccuracy(KinFunction kin, double *max_error)
+{
+  Error err;
+  float angle[AXIS_AMOUNT];
+  double angle_ref[AXIS_AMOUNT];
+  *max_error = 0;
+  for (int32_t x = WS_X_MIN; x <= WS_X_MAX; x += WS_STEP)
+  {
+    for (int32_t y = WS_Y_MIN; y <= WS_Y_MAX; y += WS_STEP)
+    {
+      for (int32_t z = WS_Z_MIN; z <= WS_Z_MAX; z += WS_STEP)
+      {
+        if (KinGetAnglesRef(x, y, z, angle_ref) != _Success) continue;
+        // Both implementations must agree on which points can be reached.
+        err = assertTrue(kin(x, y, z, angle) == _Success);
+        if (err != _Success) goto e;
+        for (uint8_t i = 0; i < AXIS_AMOUNT; i++)
+        {
+          double error = fabs(angle[i] - angle_ref[i]);
+          if (error > *max_error) *max_error = error;
+        }
+      }
+    }
+  }
+  return assertTrue(*max_error <= KIN_MAX_ERROR);
+  e:
+  return err;
+}
+
+/**
+  * @brief This test checks the Jacobian against the finite differences
+  * of the reference kinematics over the workspace.
+  */
+static Error TestJacobian(void)
+{
+  const double h = 1e-4;  // mm
+  float J[AXIS_AMOUNT][AXIS_AMOUNT];
+  double angle_l[AXIS_AMOUNT], angle_h[AXIS_AMOUNT];
+  for (int32_t x = WS_X_MIN; x <= WS_X_MAX; x += 10*WS_STEP)
+  {
+    for (int32_t y = WS_Y_MIN; y <= WS_Y_MAX; y += 10*WS_STEP)
+    {
+      for (int32_t z = WS_Z_MIN; z <= WS_Z_MAX; z += 10*WS_STEP)
+      {
+        if ( (x == 0) || (y == 0) ) continue;  // atan(Z/0)
+        if (KinGetJacobian(x, y, z, J) != _Success) continue;
+        for (uint8_t i = 0; i < AXIS_AMOUNT; i++)
+        {
+          double dl[AXIS_AMOUNT] = {x, y, z};
+          double dh[AXIS_AMOUNT] = {x, y, z};
+          dl[i] -= h;
+          dh[i] += h;
+          if (KinGetAnglesRef(dl[_X], dl[_Y], dl[_Z], angle_l) != _Success) continue;
+          if (KinGetAnglesRef(dh[_X], dh[_Y], dh[_Z], angle_h) != _Success) continue;
+          for (uint8_t j = 0; j < AXIS_AMOUNT; j++)
+          {
+            double d = (angle_h[j] - angle_l[j])/(2*h);
+            if (assertTrue(fabs(J[j][i] - d) <= 1e-3*(1 + fabs(d))) != _Success) return _UnitTestError;
+          }
+        }
+      }
+    }
+  }
+  return _Success;
+}
+
+/**
+  * @brief This test checks that KinGetPoint() finds the points of the
+  * reference angles over the workspace, starting from 10 mm off them.
+  */
+static Error TestPoint(void)
+{
+  double angle[AXIS_AMOUNT];
+  for (int32_t x = WS_X_MIN; x <= WS_X_MAX; x += 10*WS_STEP)
+  {
+    for (int32_t y = WS_Y_MIN; y <= WS_Y_MAX; y += 10*WS_STEP)
+    {
+      for (int32_t z = WS_Z_MIN; z <= WS_Z_MAX; z += 10*WS_STEP)
+      {
+        if ( (x == 0) || (y == 0) ) continue;  // atan(Z/0)
+        if (KinGetAnglesRef(x, y, z, angle) != _Success) continue;
+        double point[3] = {x + 10, y - 10, z + 10};
+        if (KinGetPoint(angle, point) != _Success) continue;  // The guess is out of reach
+        double error = fabs(point[0] - x) + fabs(point[1] - y) + fabs(point[2] - z);
+        if (assertTrue(error <= 3*KIN_POINT_TOLERANCE) != _Success) return _UnitTestError;
+      }
+    }
+  }
+  return _Success;
+}
+
+/**
+  * @brief This test checks that the points out of reach and the ones
+  * the angles aren't defined at are rejected
+  */
+static Error TestOutOfRange(void)
+{
+  float angle[AXIS_AMOUNT];
+  Error err;
+  err = assertTrue(KinGetAngles(0, 1000, 0, angle) == _OutOfRange);
+  if (err != _Success) goto e;
+  err = assertTrue(KinGetAngles(1000, 0, 0, angle) == _OutOfRange);
+  if (err != _Success) goto e;
+  // atan(0/0) mustn't give NaN angles.
+  err = assertTrue(KinGetAngles(10, 0, 0, angle) == _OutOfRange);
+  if (err != _Success) goto e;
+  err = assertTrue(KinGetAngles(0, 10, 0, angle) == _OutOfRange);
+  if (err != _Success) goto e;
+  err = assertTrue(KinLookUpAngles(10, 0, 0, angle) == _OutOfRange);
+  if (err != _Success) goto e;
+  return assertTrue(KinLookUpAngles(1000, 0, 0, angle) == _OutOfRange);
+  e:
+  return err;
+}
+
+Error KinematicsTestAll(void)
+{
+  double max_error;
+  if (TestAccuracy(KinGetAngles, &max_error) != _Success) return _UnitTestError;
+  if (TestAccuracy(KinLookUpAngles, &max_error) != _Success) return _UnitTestError;
+  if (TestJacobian() != _Success) return _UnitTestError;
+  if (TestPoint() != _Success) return _UnitTestError;
+  if (TestOutOfRange() != _Success) return _UnitTestError;
+  return _Success;
+}
+
+#ifdef KIN_TEST_HOST
+#include "stdio.h"
+
+int main(void)
+{
+  double max_error;
+  Error err = TestAccuracy(KinGetAngles, &max_error);
+  printf("KinGetAngles max error %g grads (limit %g)\n", max_error, KIN_MAX_ERROR);
+  if (err == _Success) err = TestAccuracy(KinLookUpAngles, &max_error);
+  printf("KinLookUpAngles max error %g grads (limit %g)\n", max_error, KIN_MAX_ERROR);
+  if (err == _Success) err = TestJacobian();
+  if (err == _Success) err = TestPoint();
+  if (err == _Success) err = TestOutOfRange();
+  printf("%s\n", err == _Success ? "PASSED" : "FAILED");
+  return err == _Success ? 0 : 1;
+}
+#endif
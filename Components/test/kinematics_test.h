@@ -0,0 +1,26 @@
+/**
+  ******************************************************************************
+  * @file    kinematics_test.h
+  * @author  Nikita lazarev <nikitaterm@gmail.com>
+  * @version V1.01
+  * @date    29-May-2016
+  * @brief   Header file of the inverse kinematics tests.
+  ******************************************************************************
+  * Project: P3D_firmware
+  * Description:
+  * Unit tests for the kinematics module. The tests don't use any hardware,
+  * so they can be run on the host as well:
+  * gcc -DKIN_TEST_HOST -I../Inc kinematics_test.c ../Src/kinematics.c -lm
+  */
+
+#ifndef KINEMATICS_TEST_H_
+#define KINEMATICS_TEST_H_
+
+#include "error.h"
+
+/**
+  * @brief Run all tests
+  */
+Error KinematicsTestAll(void);
+
+#endif
@@ -68,6 +68,45 @@ static Error TestAngleFeedBack(Axis axis)
   return err;
 }
 
+/**
+  * @brief This test checks that queued moves are executed back to back
+  * and each axis ends up at the target of the last move.
+  */
+static Error TestMotionQueue(void)
+{
+  Error err;
+  double rpm[AXIS_AMOUNT] = {100, 100, 100};
+  double angle[AXIS_AMOUNT] = {0, 0, 0};
+  for (uint8_t i = 1; i <= 4; i++)
+  {
+    angle[_X] = 90*i;
+    angle[_Y] = -90*i;
+    angle[_Z] = 45*i;
+    err = MotorQueueMove(rpm, angle);
+    if (err != _Success) goto e;
+  }
+  err = assertTrue(IsMotorQueueBusy());
+  if (err != _Success) goto e;
+  err = assertTrue(IsMotorBusy(_X) && IsMotorBusy(_Y) && IsMotorBusy(_Z));
+  if (err != _Success) goto e;
+  while(IsMotorQueueBusy());
+  err = assertTrue(MotorGetAngle(_X) == 360);
+  if (err != _Success) goto e;
+  err = assertTrue(MotorGetAngle(_Y) == -360);
+  if (err != _Success) goto e;
+  err = assertTrue(MotorGetAngle(_Z) == 180);
+  if (err != _Success) goto e;
+  angle[_X] = 0;
+  angle[_Y] = 0;
+  angle[_Z] = 0;
+  err = MotorQueueMove(rpm, angle);
+  if (err != _Success) goto e;
+  while(IsMotorQueueBusy());
+  return assertTrue(MotorQueueGetFree() > 0);
+  e:
+  return err;
+}
+
 // TODO: more tests!
 Error MotorTestAll(void)
 {
@@ -75,6 +114,657 @@ Error MotorTestAll(void)
   if (TestAngleFeedBack(_X) != _Success) return _UnitTestError;
   if (TestAngleFeedBack(_Y) != _Success) return _UnitTestError;
   if (TestAngleFeedBack(_Z) != _Success) return _UnitTestError;
+  if (TestMotionQueue() != _Success) return _UnitTestError;
   if (FinishTests() != _Success) return _UnitTestError;
   return _Success;  
 }
+
+#ifdef MOTOR_TEST_HOST
+/* The step engine is checked on the host: its internals are reached by
+ * including the source, the HAL and the RTOS are the stand-ins of host/.
+ * The timer isn't simulated, the tests refill the table themselves.
+ */
+#include "stdio.h"
+#include "stepMotor.c"
+
+#define HOST_MAX_HALVES     100000  // Specifies the number of the halves a queue must be executed in
+#define HOST_SHAPER_FREQ    40      // Specifies the shaper frequency the tests use, Hz
+#define HOST_SHAPER_DAMPING 0.1f    // Specifies the shaper damping ratio the tests use
+#define HOST_RATE(rpm)      ((uint32_t)((rpm)*RATE_PER_RPM))          // Rate of the speed, rpm
+#define HOST_PERIOD(rate)   (((uint64_t)TIM_FRQ << (8 + MOTOR_RATE_SHIFT))/(rate))  // Period of the rate as RampStep() calculates it
+
+/**
+  * @brief Output of the queue executed by the tests
+  */
+typedef struct
+{
+  uint32_t steps[AXIS_AMOUNT];    /**< Number of the steps of every axis output */
+
+  uint32_t events;                /**< Number of the slots stepping any axis */
+
+  uint64_t time;                  /**< Ticks output */
+
+  uint64_t first_step;            /**< Time of the first step event */
+
+  uint64_t last_step;             /**< Time of the last step event */
+
+  uint64_t first_period;          /**< Period between the first two step events */
+
+  uint64_t min_period;            /**< Shortest period between the step events */
+
+} Host_RunTypeDef;
+
+/**
+  * @brief Execute the half of the table DMA is at, as the refill IRQ does
+  * when the timer is through it. Returns 0 if the engine is stopped.
+  */
+static uint8_t RunHalf(Host_RunTypeDef* run)
+{
+  uint32_t first = engine.half*(MOTOR_SLOTS/2);
+  for (uint32_t slot = first; slot < first + MOTOR_SLOTS/2; slot++)
+  {
+    uint8_t stepped = 0;
+    for (uint8_t i = 0; i < AXIS_AMOUNT; i++)
+    {
+      run->steps[i] += (slot_delta[slot][i] < 0) ? -slot_delta[slot][i] : slot_delta[slot][i];
+      if (slot_delta[slot][i] != 0) stepped = 1;
+    }
+    // The steps are output at the start of the slot.
+    if (stepped)
+    {
+      uint64_t period = run->time - run->last_step;
+      if (run->events == 0) run->first_step = run->time;
+      else if (run->events == 1) run->first_period = run->min_period = period;
+      else if (period < run->min_period) run->min_period = period;
+      run->last_step = run->time;
+      run->events++;
+    }
+    run->time += slot_arr[slot] + 1;
+  }
+  return HalfDone(engine.half);
+}
+
+/**
+  * @brief Execute the queue until the engine stops
+  */
+static Error RunQueue(Host_RunTypeDef* run)
+{
+  for (uint32_t i = 0; i < HOST_MAX_HALVES; i++)
+  {
+    if (!RunHalf(run)) return assertTrue(queue_tail == queue_head);
+  }
+  return _UnitTestError;
+}
+
+/**
+  * @brief Get the impulses of the shaper from its definition, in double
+  * precision. Returns the number of the impulses.
+  */
+static uint8_t ShaperImpulses(Shaper shaper, double freq, double damping,
+                              double amp[SHAPER_TAPS], double time[SHAPER_TAPS])
+{
+  double df = sqrt(1 - damping*damping);
+  double period = 1/(freq*df);
+  double k = exp(-damping*M_PI/df);
+  double v = SHAPER_EI_VTOL;
+  time[0] = 0;
+  switch (shaper)
+  {
+    case _ZV:
+      amp[0] = 1;
+      amp[1] = k;
+      time[1] = period/2;
+      return 2;
+    case _MZV:
+      k = exp(-0.75*damping*M_PI/df);
+      amp[0] = 1 - 1/sqrt(2);
+      amp[1] = (sqrt(2) - 1)*k;
+      amp[2] = amp[0]*k*k;
+      time[1] = 0.375*period;
+      time[2] = 0.75*period;
+      return 3;
+    case _EI:
+      amp[0] = (1 + v)/4;
+      amp[1] = (1 - v)/2*k;
+      amp[2] = amp[0]*k*k;
+      time[1] = period/2;
+      time[2] = period;
+      return 3;
+    default:
+      return 0;
+  }
+}
+
+/**
+  * @brief Get the vibration left by the impulses set at the frequency,
+  * relative to the one of the unshaped motion
+  */
+static double ShaperResidual(double freq, double damping)
+{
+  double w = 2*M_PI*freq;
+  double wd = w*sqrt(1 - damping*damping);
+  double last = (double)queue_impulse[queue_taps - 1].delay/TIM_FRQ;
+  double c = 0;
+  double s = 0;
+  for (uint8_t k = 0; k < queue_taps; k++)
+  {
+    double t = (double)queue_impulse[k].delay/TIM_FRQ;
+    double a = (double)queue_impulse[k].amp/(1 << SHAPER_AMP_SHIFT)*exp(damping*w*(t - last));
+    c += a*cos(wd*t);
+    s += a*sin(wd*t);
+  }
+  return sqrt(c*c + s*s);
+}
+
+/**
+  * @brief This test checks the impulses of every shaper against its
+  * definition. The amplitudes sum up to 1 exactly, the ZV and the MZV
+  * shapers cancel the vibration at their frequency and the EI one leaves
+  * SHAPER_EI_VTOL of it, less if the vibration is damped.
+  */
+static Error TestShaperImpulses(void)
+{
+  const Shaper shapers[] = {_ZV, _MZV, _EI};
+  const float dampings[] = {0, HOST_SHAPER_DAMPING};
+  Error err;
+  for (uint8_t n = 0; n < sizeof(shapers)/sizeof(shapers[0])*2; n++)
+  {
+    Shaper shaper = shapers[n/2];
+    float damping = dampings[n & 1];
+    double amp[SHAPER_TAPS];
+    double time[SHAPER_TAPS];
+    uint8_t taps = ShaperImpulses(shaper, HOST_SHAPER_FREQ, damping, amp, time);
+    err = MotorSetShaper(shaper, HOST_SHAPER_FREQ, damping);
+    if (err != _Success) goto e;
+    err = assertTrue(queue_taps == taps);
+    if (err != _Success) goto e;
+    double sum = 0;
+    for (uint8_t k = 0; k < taps; k++)
+    {
+      sum += amp[k];
+    }
+    int32_t total = 0;
+    for (uint8_t k = 0; k < taps; k++)
+    {
+      // The last amplitude takes the rounding errors of the other ones.
+      double expected = amp[k]/sum*(1 << SHAPER_AMP_SHIFT);
+      err = assertTrue(fabs(queue_impulse[k].amp - expected) < ((k == taps - 1) ? taps : 1));
+      if (err != _Success) goto e;
+      expected = time[k]*TIM_FRQ;
+      err = assertTrue(fabs(queue_impulse[k].delay - expected) <= 1 + expected*1e-6);
+      if (err != _Success) goto e;
+      total += queue_impulse[k].amp;
+    }
+    err = assertTrue(total == 1 << SHAPER_AMP_SHIFT);
+    if (err != _Success) goto e;
+    double residual = ShaperResidual(HOST_SHAPER_FREQ, damping);
+    if (shaper != _EI) err = assertTrue(residual < 1e-3);
+    else if (damping == 0) err = assertTrue(fabs(residual - SHAPER_EI_VTOL) < 1e-3);
+    else err = assertTrue(residual < SHAPER_EI_VTOL);
+    if (err != _Success) goto e;
+  }
+  err = MotorSetShaper(_NoShaper, 0, 0);
+  if (err != _Success) goto e;
+  return assertTrue(queue_taps == 0);
+  e:
+  return err;
+}
+
+/**
+  * @brief This test checks that every shaper outputs exactly the steps of
+  * the moves queued: the axises don't step back and forth on the way and
+  * end up at the targets. The directions are reversed from shaper to shaper.
+  */
+static Error TestShaperSteps(void)
+{
+  const Shaper shapers[] = {_ZV, _MZV, _EI};
+  const double rpm[AXIS_AMOUNT] = {300, 300, 300};
+  Error err;
+  for (uint8_t s = 0; s < sizeof(shapers)/sizeof(shapers[0]); s++)
+  {
+    double sign = (s & 1) ? -1 : 1;
+    int64_t start[AXIS_AMOUNT];
+    double angle[AXIS_AMOUNT];
+    for (uint8_t i = 0; i < AXIS_AMOUNT; i++)
+    {
+      start[i] = drivers[i].angle;
+      angle[i] = MotorGetAngle((Axis)i);
+    }
+    err = MotorSetShaper(shapers[s], HOST_SHAPER_FREQ, HOST_SHAPER_DAMPING);
+    if (err != _Success) goto e;
+    // Z pauses in the second move.
+    for (uint8_t m = 1; m <= 3; m++)
+    {
+      angle[_X] += sign*90*m;
+      angle[_Y] -= sign*45;
+      if (m != 2) angle[_Z] += sign*30;
+      err = MotorQueueMove(rpm, angle);
+      if (err != _Success) goto e;
+    }
+    Host_RunTypeDef run = {{0}};
+    err = RunQueue(&run);
+    if (err != _Success) goto e;
+    for (uint8_t i = 0; i < AXIS_AMOUNT; i++)
+    {
+      err = assertTrue(drivers[i].angle == queue_angle[i]);
+      if (err != _Success) goto e;
+      int64_t steps = queue_angle[i] - start[i];
+      err = assertTrue(run.steps[i] == ((steps < 0) ? -steps : steps));
+      if (err != _Success) goto e;
+    }
+  }
+  return MotorSetShaper(_NoShaper, 0, 0);
+  e:
+  return err;
+}
+
+/**
+  * @brief Make a move of the X axis with the profile calculated as
+  * QueueBlock() does with no feed rate override
+  */
+static Error MakeBlock(Ramp ramp, uint32_t steps, uint32_t rate, uint32_t entry_rate,
+                       uint32_t exit_rate, StMotor_BlockTypeDef* block)
+{
+  for (uint8_t i = 0; i < AXIS_AMOUNT; i++)
+  {
+    block->steps[i] = 0;
+    block->dir[i] = 1;
+  }
+  block->steps[_X] = steps;
+  block->step_events = steps;
+  block->feed_floor = 1 << FEED_SHIFT;
+  return ComputeProfile(ramp, rate, entry_rate, exit_rate, MOTOR_START_RATE, steps,
+                        MOTOR_ACCEL_STEPS, &block->profile);
+}
+
+/**
+  * @brief Start the ramp of the move as LoadBlock() does, but the move
+  * isn't queued: the tests walk the ramp step by step by RampStep().
+  * engine.block must be reset when the walk is over.
+  */
+static void StartRamp(StMotor_BlockTypeDef* block)
+{
+  StMotor_ProfileTypeDef* profile = &block->profile;
+  engine.block = block;
+  engine.step = 0;
+  engine.end = block->step_events;
+  engine.n = profile->n_start;
+  engine.c = profile->c_start;
+  engine.c_frac = 0;
+  engine.multi = 1;
+  engine.multi_left = 0;
+  engine.multi_extra = 0;
+  engine.scurve.left = 0;
+  engine.feed_scale = 1 << FEED_SHIFT;
+  if ( (profile->ramp == _SCurve) && (profile->accel_steps != 0) )
+  {
+    SCurveStart(profile->entry_rate, profile->peak_rate, profile->accel_steps);
+  }
+}
+
+/**
+  * @brief This test checks the S-curve ramps between the rates: the ramp
+  * of the steps SCurveSteps() gives ends at the target rate exactly, the
+  * rate doesn't overshoot, and the acceleration starts and ends at zero
+  * and doesn't exceed MOTOR_ACCEL.
+  */
+static Error TestSCurveRamp(void)
+{
+  const uint32_t rates[][2] = { {MOTOR_START_RATE, HOST_RATE(300)},
+                                {HOST_RATE(300), MOTOR_START_RATE},
+                                {HOST_RATE(100), HOST_RATE(600)},
+                                {HOST_RATE(600), HOST_RATE(590)} };
+  Error err;
+  for (uint8_t r = 0; r < sizeof(rates)/sizeof(rates[0]); r++)
+  {
+    uint32_t from = rates[r][0];
+    uint32_t to = rates[r][1];
+    uint32_t low = (from < to) ? from : to;
+    uint32_t high = (from < to) ? to : from;
+    uint32_t steps = SCurveSteps(low, high, MOTOR_ACCEL_STEPS);
+    // The change of the acceleration peaks at the ends of the ramp, the
+    // rates are rounded.
+    double jerk = 6.0*(high - low)/((double)steps*steps) + 2;
+    int64_t rate = from;
+    int64_t change = 0;   // The acceleration is zero before the ramp
+    SCurveStart(from, to, steps);
+    for (uint32_t k = 0; k < steps; k++)
+    {
+      int64_t next = SCurveStep();
+      err = assertTrue( (next >= low) && (next <= high) && ((next - rate)*((int64_t)to - from) >= 0) );
+      if (err != _Success) goto e;
+      err = assertTrue(fabs((double)(next - rate - change)) <= jerk);
+      if (err != _Success) goto e;
+      // Rates in steps/s, the step takes 1/rate.
+      double accel = fabs((double)(next - rate))*next/(1 << (2*MOTOR_RATE_SHIFT));
+      err = assertTrue(accel <= MOTOR_ACCEL_STEPS*1.01);
+      if (err != _Success) goto e;
+      change = next - rate;
+      rate = next;
+    }
+    err = assertTrue( (rate == to) && (engine.scurve.left == 0) );
+    if (err != _Success) goto e;
+    err = assertTrue(fabs((double)change) <= jerk);  // The acceleration is zero after the ramp
+    if (err != _Success) goto e;
+  }
+  return _Success;
+  e:
+  return err;
+}
+
+/**
+  * @brief This test checks the S-curve profiles of the moves: the peak rate
+  * is reached in accel_steps, the exit rate at the last step, and there is
+  * no jump of the acceleration where the ramps join the cruise.
+  */
+static Error TestSCurveProfile(void)
+{
+  // The moves reaching the rate, too short for it, and entered and exited at speed.
+  const uint32_t moves[][4] = { {20000, HOST_RATE(300), 0, 0},
+                                {2000, HOST_RATE(300), 0, 0},
+                                {6000, HOST_RATE(300), HOST_RATE(100), HOST_RATE(200)},
+                                {300, HOST_RATE(300), HOST_RATE(200), HOST_RATE(100)} };
+  StMotor_BlockTypeDef block;
+  Error err;
+  for (uint8_t m = 0; m < sizeof(moves)/sizeof(moves[0]); m++)
+  {
+    err = MakeBlock(_SCurve, moves[m][0], moves[m][1], moves[m][2], moves[m][3], &block);
+    if (err != _Success) goto e;
+    StMotor_ProfileTypeDef* profile = &block.profile;
+    err = assertTrue( (profile->peak_rate <= moves[m][1]) &&
+                      (profile->accel_steps + (moves[m][0] - profile->decel_start) < moves[m][0]) );
+    if (err != _Success) goto e;
+    // The rates are calculated back from the periods, which are rounded.
+    uint32_t high = (profile->entry_rate > profile->exit_rate) ? profile->entry_rate : profile->exit_rate;
+    uint32_t ramp = (profile->accel_steps > 1) ? profile->accel_steps : 1;
+    double jerk = 6.0*(profile->peak_rate - profile->entry_rate)/((double)ramp*ramp) + 8;
+    ramp = (moves[m][0] - profile->decel_start > 1) ? moves[m][0] - profile->decel_start : 1;
+    double decel_jerk = 6.0*(profile->peak_rate - profile->exit_rate)/((double)ramp*ramp) + 8;
+    if (decel_jerk > jerk) jerk = decel_jerk;
+    if (profile->peak_rate < high) jerk = profile->peak_rate;  // The squeezed ramp isn't checked
+    StartRamp(&block);
+    int64_t rate = profile->entry_rate;
+    int64_t change = 0;
+    for (engine.step = 1; engine.step < engine.end; engine.step++)
+    {
+      RampStep(1);
+      int64_t next = (int64_t)HOST_PERIOD(1)/engine.c;
+      if (engine.step == profile->accel_steps)
+      {
+        err = assertTrue(engine.c == HOST_PERIOD(profile->peak_rate));
+        if (err != _Success) break;
+      }
+      err = assertTrue(fabs((double)(next - rate - change)) <= jerk);
+      if (err != _Success) break;
+      change = next - rate;
+      rate = next;
+    }
+    engine.block = NULL;
+    if (err != _Success) goto e;
+    err = assertTrue(engine.c == HOST_PERIOD(profile->exit_rate));
+    if (err != _Success) goto e;
+  }
+  return _Success;
+  e:
+  return err;
+}
+
+/**
+  * @brief Get the shortest time of the steps of a motor starting and
+  * stopping at MOTOR_START_RPM, in timer ticks
+  */
+static double MinMoveTime(uint32_t steps)
+{
+  double v0 = (double)MOTOR_START_RATE/(1 << MOTOR_RATE_SHIFT);
+  double v = (double)MOTOR_MAX_RATE/(1 << MOTOR_RATE_SHIFT);
+  double ramp = (v*v - v0*v0)/MOTOR_ACCEL_STEPS;   // Steps to speed up and slow down
+  if (steps < ramp) v = sqrt(MOTOR_ACCEL_STEPS*(double)steps + v0*v0);
+  double time = 2*(v - v0)/MOTOR_ACCEL_STEPS + ((steps < ramp) ? 0 : (steps - ramp)/v);
+  return time*TIM_FRQ;
+}
+
+/**
+  * @brief This test checks that the feed rate override doesn't speed the
+  * motors up beyond MOTOR_START_RPM, MOTOR_MAX_RPM and MOTOR_ACCEL: neither
+  * the moves queued before the override is raised nor the ones queued with it.
+  */
+static Error TestFeedFloor(void)
+{
+  const uint32_t steps = 40000;
+  uint64_t max_period = HOST_PERIOD(MOTOR_MAX_RATE) >> 8;
+  uint64_t start_period = HOST_PERIOD(MOTOR_START_RATE) >> 8;
+  Error err;
+  for (uint8_t m = 0; m < 2; m++)
+  {
+    // The first move is queued at 100% and raised to 200% while it's executed.
+    err = MotorSetFeedRate(m ? FEED_MAX : 100);
+    if (err != _Success) goto e;
+    QueueSync();
+    int32_t target[AXIS_AMOUNT] = {(int32_t)queue_angle[_X] + steps, (int32_t)queue_angle[_Y], (int32_t)queue_angle[_Z]};
+    StMotor_BlockTypeDef* block = &queue[queue_head & (MOTOR_QUEUE_SIZE - 1)];
+    err = MotorQueueMoveRate(target, MOTOR_MAX_RATE, 0, 0);
+    if (err != _Success) goto e;
+    err = MotorSetFeedRate(FEED_MAX);
+    if (err != _Success) goto e;
+    err = assertTrue(block->feed_floor == (m ? ((100 << FEED_SHIFT)/FEED_MAX) : (1 << FEED_SHIFT)));
+    if (err != _Success) goto e;
+    Host_RunTypeDef run = {{0}};
+    err = RunQueue(&run);
+    if (err != _Success) goto e;
+    // The second step is sped up by the ramp already.
+    err = assertTrue( (run.steps[_X] == steps) && (run.min_period + 1 >= max_period) &&
+                      (run.first_period >= start_period*98/100) );
+    if (err != _Success) goto e;
+    // The override gets the motor to MOTOR_MAX_RPM in the second move.
+    if (m) err = assertTrue(run.min_period <= max_period + max_period/100);
+    if (err != _Success) goto e;
+    err = assertTrue(run.last_step - run.first_step >= 0.995*MinMoveTime(steps - 1));
+    if (err != _Success) goto e;
+  }
+  return MotorSetFeedRate(100);
+  e:
+  MotorSetFeedRate(100);
+  return err;
+}
+
+/**
+  * @brief Calculate the ticks to the next step of the ramp started, as
+  * CalcSlot() does after a step
+  */
+static uint32_t WalkStep(void)
+{
+  engine.step++;
+  return NextStep();
+}
+
+/**
+  * @brief This test checks the deceleration of a quick stop: its length is
+  * the one to MOTOR_START_RPM from the period being output, the feed rate
+  * override and the group of steps included. The ramp starts without a
+  * jump of the period and ends at MOTOR_START_RPM.
+  */
+static Error TestQuickStopRamp(void)
+{
+  StMotor_BlockTypeDef block;
+  Error err = _Success;
+  for (uint8_t m = 0; m < 4; m++)
+  {
+    Ramp ramp = (m & 1) ? _SCurve : _Trapezoidal;
+    uint32_t feed = (m & 2) ? FEED_MAX : 100;
+    err = MotorSetFeedRate(feed);
+    if (err != _Success) break;
+    err = MakeBlock(ramp, 40000, MOTOR_MAX_RATE*100/feed, 0, 0, &block);
+    if (err != _Success) break;
+    block.feed_floor = feed_target;
+    StartRamp(&block);
+    engine.feed_scale = feed_target;
+    // Stop within a group of steps accelerating.
+    uint32_t ticks = 0;
+    while ( (engine.step < 5000) || (engine.multi_left == 0) ) ticks = WalkStep();
+    uint32_t step = engine.step;
+    uint32_t period = engine.period;
+    uint32_t rate = (uint32_t)(HOST_PERIOD(1)/period);
+    queue_stopping = 1;
+    QuickStopStart();
+    uint32_t steps = (ramp == _SCurve) ? SCurveSteps(MOTOR_START_RATE, rate, MOTOR_ACCEL_STEPS) :
+                     RateToRampStep(rate, MOTOR_ACCEL_STEPS) - RateToRampStep(MOTOR_START_RATE, MOTOR_ACCEL_STEPS);
+    err = assertTrue( (engine.end == step + 1 + steps) && (engine.c == period) && (engine.multi_left == 0) );
+    // The period goes up from the one output to the one of MOTOR_START_RPM.
+    uint32_t last = ticks;
+    while ( (err == _Success) && (engine.step + 1 < engine.end) )
+    {
+      uint32_t next = WalkStep();
+      err = assertTrue( (next + 1 >= last) && (next <= last + last/50) );
+      last = next;
+    }
+    queue_stopping = 0;
+    engine.block = NULL;
+    if (err != _Success) break;
+    err = assertTrue(fabs(last - (double)(HOST_PERIOD(MOTOR_START_RATE) >> 8)) < 0.02*last);
+    if (err != _Success) break;
+  }
+  if (err == _Success) err = MotorSetFeedRate(100);
+  else MotorSetFeedRate(100);
+  return err;
+}
+
+/**
+  * @brief This test checks that the queue continues from the position a
+  * quick stop has overshot the move to: the move being executed is extended
+  * along its line, the next one is dropped, and the move queued after the
+  * stop ends at its target.
+  */
+static Error TestQuickStopResync(void)
+{
+  const double rpm[AXIS_AMOUNT] = {300, 300, 300};
+  double angle[AXIS_AMOUNT];
+  Error err;
+  for (uint8_t i = 0; i < AXIS_AMOUNT; i++)
+  {
+    angle[i] = MotorGetAngle((Axis)i);
+  }
+  int64_t start = drivers[_X].angle;
+  uint32_t move = queue_head;
+  // The first move is left at speed, the stop is requested close to its end.
+  angle[_X] += 720;
+  err = MotorQueueMoveEx(rpm, angle, 0, 1);
+  if (err != _Success) goto e;
+  int64_t first = queue_angle[_X];
+  angle[_X] += 720;
+  err = MotorQueueMoveEx(rpm, angle, 1, 0);
+  if (err != _Success) goto e;
+  Host_RunTypeDef run = {{0}};
+  uint32_t halves = 0;
+  while ( (engine.move != move) || (engine.block == NULL) || (engine.end - engine.step > 300) )
+  {
+    err = assertTrue( (halves++ < HOST_MAX_HALVES) && RunHalf(&run) );
+    if (err != _Success) goto e;
+  }
+  err = MotorQuickStop();
+  if (err != _Success) goto e;
+  err = RunQueue(&run);
+  if (err != _Success) goto e;
+  err = assertTrue( !IsMotorStopping() && (drivers[_X].angle > first) && (drivers[_X].angle < queue_angle[_X]) );
+  if (err != _Success) goto e;
+  angle[_X] = MotorStepsToAngle((int32_t)start);
+  err = MotorQueueMove(rpm, angle);
+  if (err != _Success) goto e;
+  err = RunQueue(&run);
+  if (err != _Success) goto e;
+  return assertTrue( (drivers[_X].angle == start) && (queue_angle[_X] == start) );
+  e:
+  return err;
+}
+
+/**
+  * @brief Walk the ramp of the move and check its groups of steps: every
+  * group is doubled above its multi-step rate and halved below the rate of
+  * the smaller group less MULTI_STEP_HYST only, and the groups of the move
+  * sum up to its steps. up and down get the masks of the group sizes
+  * switched to.
+  */
+static Error WalkGroups(StMotor_BlockTypeDef* block, uint8_t* up, uint8_t* down)
+{
+  Error err = _Success;
+  uint32_t grouped = 1;   // The first step is calculated by LoadBlock()
+  *up = 0;
+  *down = 0;
+  StartRamp(block);
+  while ( (err == _Success) && (engine.step + 1 < engine.end) )
+  {
+    if (engine.multi_left != 0)
+    {
+      WalkStep();
+      continue;
+    }
+    // The group is chosen by the rate of the last step calculated.
+    double f = (double)TIM_FRQ/(engine.c >> 8);
+    uint8_t multi = engine.multi;
+    double high = (double)MULTI_STEP_RATE*multi;
+    double low = (double)MULTI_STEP_RATE*multi/2*100/(100 + MULTI_STEP_HYST);
+    WalkStep();
+    uint32_t k = engine.multi_left + 1u;
+    grouped += k;
+    if (engine.multi > multi) *up |= engine.multi;
+    if (engine.multi < multi) *down |= engine.multi;
+    if (engine.multi > multi) err = assertTrue( (engine.multi == 2*multi) && (f >= 0.999*high) );
+    else if (engine.multi < multi) err = assertTrue( (engine.multi == multi/2) && (f <= 1.001*low) );
+    else err = assertTrue( ((multi == MULTI_STEP_MAX) || (f <= 1.001*high)) && ((multi == 1) || (f >= 0.999*low)) );
+    // The last group is cut at the end of the move.
+    if (err == _Success) err = assertTrue( (k == engine.multi) || (engine.step + k == engine.end) );
+  }
+  engine.block = NULL;
+  if (err != _Success) return err;
+  return assertTrue(grouped == block->step_events);
+}
+
+/**
+  * @brief This test checks the groups of steps of a move ramping up beyond
+  * the multi-step rate of MULTI_STEP_MAX and down, and of a move ending
+  * in the middle of a group at speed. The engine outputs all steps of the
+  * groups.
+  */
+static Error TestMultiStep(void)
+{
+  const uint32_t steps = 150000;
+  const uint32_t rate = 60000 << MOTOR_RATE_SHIFT;
+  StMotor_BlockTypeDef block;
+  uint8_t up;
+  uint8_t down;
+  Error err = MakeBlock(_Trapezoidal, steps, rate, 0, 0, &block);
+  if (err != _Success) return err;
+  err = WalkGroups(&block, &up, &down);
+  if (err != _Success) return err;
+  err = assertTrue( (up == (2 | 4 | 8)) && (down == (1 | 2 | 4)) );
+  if (err != _Success) return err;
+  err = MakeBlock(_Trapezoidal, 1003, rate, rate, rate, &block);
+  if (err != _Success) return err;
+  err = WalkGroups(&block, &up, &down);
+  if (err != _Success) return err;
+  err = assertTrue( (up == (2 | 4 | 8)) && (down == 0) );
+  if (err != _Success) return err;
+  QueueSync();
+  int32_t target[AXIS_AMOUNT] = {(int32_t)queue_angle[_X] + steps, (int32_t)queue_angle[_Y], (int32_t)queue_angle[_Z]};
+  err = MotorQueueMoveRate(target, rate, 0, 0);
+  if (err != _Success) return err;
+  Host_RunTypeDef run = {{0}};
+  err = RunQueue(&run);
+  if (err != _Success) return err;
+  return assertTrue( (run.steps[_X] == steps) && (run.events == steps) && (drivers[_X].angle == target[_X]) );
+}
+
+int main(void)
+{
+  Error err = SMotorDriversInit();
+  if (err == _Success) err = TestShaperImpulses();
+  if (err == _Success) err = TestShaperSteps();
+  if (err == _Success) err = TestSCurveRamp();
+  if (err == _Success) err = TestSCurveProfile();
+  if (err == _Success) err = TestFeedFloor();
+  if (err == _Success) err = TestQuickStopRamp();
+  if (err == _Success) err = TestQuickStopResync();
+  if (err == _Success) err = TestMultiStep();
+  printf("%s\n", err == _Success ? "PASSED" : "FAILED");
+  return err == _Success ? 0 : 1;
+}
+#endif
@@ -8,7 +8,10 @@
   ******************************************************************************
   * Project: P3D_firmware
   * Description:
-  * Unit tests for the stepMotor module.
+  * Unit tests for the stepMotor module. The tests of the step engine's
+  * internals don't use the timer, they are run on the host with the HAL
+  * and RTOS stand-ins of host/:
+  * gcc -DMOTOR_TEST_HOST -Ihost -I../Inc -I../Src stepMotor_test.c -lm
   */
   
 #ifndef STEP_MOTOR_TEST_H_
@@ -0,0 +1,140 @@
+/**
+  ******************************************************************************
+  * @file    kinematicsLookUpGen.c
+  * @author  Nikita lazarev <nikitaterm@gmail.com>
+  * @version V1.01
+  * @date    29-May-2016
+  * @brief   Generator of the inverse kinematics look-up tables.
+  ******************************************************************************
+  * Project: P3D_firmware
+  * Description:
+  * This program is run on the host every time the mechanism geometry in
+  * kinematics.c is changed:
+  * gcc -I../Inc kinematicsLookUpGen.c ../Src/kinematics.c -lm
+  * ./a.out > ../Inc/kinematicsLookUp.h
+  * The angle of the X motor is X*Kx + f(Y, Z), the angle of the Y motor
+  * is Y*Ky + f(X, Z). The tables hold the f() functions, they are built
+  * with KinGetAnglesRef() at X = 0 and Y = 0 respectively.
+  */
+
+#include "stdio.h"
+#include "math.h"
+
+#include "kinematics.h"
+
+/** Specifies the grid (in mm). A is the coordinate the lever depends on
+  * together with Z (Y for the X motor and X for the Y motor).
+  * The grid mustn't contain A = 0, atan(Z/A) is discontinuous there.
+  */
+#define LU_A_MIN 20
+#define LU_A_MAX 300
+#define LU_Z_MIN -300
+#define LU_Z_MAX 0
+#define LU_STEP  5
+#define LU_A_SIZE ((LU_A_MAX - LU_A_MIN)/LU_STEP + 1)
+#define LU_Z_SIZE ((LU_Z_MAX - LU_Z_MIN)/LU_STEP + 1)
+
+#define ERROR_SUBSTEPS 8  // Specifies the number of points per cell the error is checked at
+
+static double lu[AXIS_AMOUNT][LU_Z_SIZE][LU_A_SIZE];
+
+static int GetLever(Axis axis, double a, double z, double *value)
+{
+  double angle[AXIS_AMOUNT];
+  if (axis == _X)
+  {
+    if (KinGetAnglesRef(0, a, z, angle) != _Success) return 1;
+  }
+  else
+  {
+    if (KinGetAnglesRef(a, 0, z, angle) != _Success) return 1;
+  }
+  *value = angle[axis];
+  return 0;
+}
+
+static double Interpolate(Axis axis, double a, double z)
+{
+  int i = (int)((a - LU_A_MIN)/LU_STEP);
+  int j = (int)((z - LU_Z_MIN)/LU_STEP);
+  if (i > LU_A_SIZE - 2) i = LU_A_SIZE - 2;
+  if (j > LU_Z_SIZE - 2) j = LU_Z_SIZE - 2;
+  double t = (a - LU_A_MIN)/LU_STEP - i;
+  double u = (z - LU_Z_MIN)/LU_STEP - j;
+  double v0 = lu[axis][j][i] + t*(lu[axis][j][i + 1] - lu[axis][j][i]);
+  double v1 = lu[axis][j + 1][i] + t*(lu[axis][j + 1][i + 1] - lu[axis][j + 1][i]);
+  return v0 + u*(v1 - v0);
+}
+
+static void PrintTable(const char *name, Axis axis)
+{
+  printf("static const float %s[KIN_LU_Z_SIZE][KIN_LU_A_SIZE] = {\n", name);
+  for (int j = 0; j < LU_Z_SIZE; j++)
+  {
+    printf("  {");
+    for (int i = 0; i < LU_A_SIZE; i++)
+    {
+      printf("%s%.7gf", (i == 0) ? "" : ((i % 6 == 0) ? ",\n   " : ", "), lu[axis][j][i]);
+    }
+    printf("}%s\n", (j == LU_Z_SIZE - 1) ? "" : ",");
+  }
+  printf("};\n\n");
+}
+
+int main(void)
+{
+  double max_error = 0;
+  for (Axis axis = _X; axis <= _Y; axis++)
+  {
+    for (int j = 0; j < LU_Z_SIZE; j++)
+    {
+      for (int i = 0; i < LU_A_SIZE; i++)
+      {
+        if (GetLever(axis, LU_A_MIN + i*LU_STEP, LU_Z_MIN + j*LU_STEP, &lu[axis][j][i]) != 0)
+        {
+          fprintf(stderr, "The grid point A=%d Z=%d can't be reached\n",
+                  LU_A_MIN + i*LU_STEP, LU_Z_MIN + j*LU_STEP);
+          return 1;
+        }
+      }
+    }
+    // Find the interpolation error over the grid.
+    for (int j = 0; j < (LU_Z_SIZE - 1)*ERROR_SUBSTEPS; j++)
+    {
+      for (int i = 0; i < (LU_A_SIZE - 1)*ERROR_SUBSTEPS; i++)
+      {
+        double a = LU_A_MIN + (double)i*LU_STEP/ERROR_SUBSTEPS;
+        double z = LU_Z_MIN + (double)j*LU_STEP/ERROR_SUBSTEPS;
+        double value;
+        if (GetLever(axis, a, z, &value) != 0) return 1;
+        double error = fabs(Interpolate(axis, a, z) - value);
+        if (error > max_error) max_error = error;
+      }
+    }
+  }
+
+  printf("/**\n");
+  printf("  ******************************************************************************\n");
+  printf("  * @file    kinematicsLookUp.h\n");
+  printf("  * @author  Nikita lazarev <nikitaterm@gmail.com>\n");
+  printf("  * @version V1.01\n");
+  printf("  * @date    29-May-2016\n");
+  printf("  * @brief   Header file with look-up tables for the inverse kinematics.\n");
+  printf("  ******************************************************************************\n");
+  printf("  * This file is generated by Components/tools/kinematicsLookUpGen.c,\n");
+  printf("  * don't edit it manually.\n");
+  printf("  */\n\n");
+  printf("/**\n");
+  printf("  * @brief Look-up tables of the lever angles, indexed by [Z][A].\n");
+  printf("  * The max error of the bilinear interpolation is %.2g grads.\n", max_error);
+  printf("  */\n");
+  printf("#define KIN_LU_A_MIN %d\n", LU_A_MIN);
+  printf("#define KIN_LU_Z_MIN %d\n", LU_Z_MIN);
+  printf("#define KIN_LU_STEP %d\n", LU_STEP);
+  printf("#define KIN_LU_A_SIZE %d\n", LU_A_SIZE);
+  printf("#define KIN_LU_Z_SIZE %d\n", LU_Z_SIZE);
+  printf("#define KIN_LU_MAX_ERROR %.2g\n\n", max_error);
+  PrintTable("kin_x_lu", _X);
+  PrintTable("kin_y_lu", _Y);
+  return 0;
+}
@@ -119,75 +119,38 @@ void HAL_TIM_Base_MspInit(TIM_HandleTypeDef* htim_base)
     HAL_GPIO_Init(GPIOB, &GPIO_InitStruct);
   }
 
-  if(htim_base->Instance==TIM9)
+  if(htim_base->Instance==TIM8)
   {
-    // Init the TIM9 and the corresponding GPIO.
-    __TIM9_CLK_ENABLE();
+    // Init the TIM8. It paces the step engine of all axises, the periods
+    // and the step outputs are written by DMA2 on its events.
+    __TIM8_CLK_ENABLE();
+    __DMA2_CLK_ENABLE();
+    __GPIOA_CLK_ENABLE();
+    __GPIOB_CLK_ENABLE();
+
+    // Init the GPIO PORTA.2, PORTB.9, PORTB.8 for the X, Y, Z step motors clock.
     GPIO_InitStruct.Pin = GPIO_PIN_2;
-    GPIO_InitStruct.Mode = GPIO_MODE_AF_PP;
+    GPIO_InitStruct.Mode = GPIO_MODE_OUTPUT_PP;
     GPIO_InitStruct.Pull = GPIO_NOPULL;
-    GPIO_InitStruct.Speed = GPIO_SPEED_LOW;
-    GPIO_InitStruct.Alternate = GPIO_AF3_TIM9;
+    GPIO_InitStruct.Speed = GPIO_SPEED_HIGH;
     HAL_GPIO_Init(GPIOA, &GPIO_InitStruct);
-    
-    // Init the GPIO PORTA.3 for a step motor enabling/disabling.
-    GPIO_InitTypeDef GPIO_InitStruct_ED;
-    GPIO_InitStruct_ED.Pin = GPIO_PIN_3;
-    GPIO_InitStruct_ED.Mode = GPIO_MODE_OUTPUT_PP;
-    HAL_GPIO_Init(GPIOA, &GPIO_InitStruct_ED);
-    
-    // Init the GPIO PORTA.1 for a step motor dir/
-    GPIO_InitTypeDef GPIO_InitStruct_DID;
-    GPIO_InitStruct_DID.Pin = GPIO_PIN_1;
-    GPIO_InitStruct_DID.Mode = GPIO_MODE_OUTPUT_PP;
-    HAL_GPIO_Init(GPIOA, &GPIO_InitStruct_DID);
-  }
-
-  if(htim_base->Instance==TIM11)
-  {
-    // Init the TIM11 and the corresponding GPIO.
-    __TIM11_CLK_ENABLE();
-    GPIO_InitStruct.Pin = GPIO_PIN_9;
-    GPIO_InitStruct.Mode = GPIO_MODE_AF_PP;
-    GPIO_InitStruct.Pull = GPIO_NOPULL;
-    GPIO_InitStruct.Speed = GPIO_SPEED_LOW;
-    GPIO_InitStruct.Alternate = GPIO_AF3_TIM11;
+    GPIO_InitStruct.Pin = GPIO_PIN_8 | GPIO_PIN_9;
     HAL_GPIO_Init(GPIOB, &GPIO_InitStruct);
 
-    // Init the GPIO PORTA.6 for a step motor enabling/disabling.
+    // Init the GPIO PORTA.3, PORTA.6, PORTA.9 for the step motors enabling/disabling.
     GPIO_InitTypeDef GPIO_InitStruct_ED;
-    GPIO_InitStruct_ED.Pin = GPIO_PIN_6;
+    GPIO_InitStruct_ED.Pin = GPIO_PIN_3 | GPIO_PIN_6 | GPIO_PIN_9;
     GPIO_InitStruct_ED.Mode = GPIO_MODE_OUTPUT_PP;
+    GPIO_InitStruct_ED.Pull = GPIO_NOPULL;
+    GPIO_InitStruct_ED.Speed = GPIO_SPEED_LOW;
     HAL_GPIO_Init(GPIOA, &GPIO_InitStruct_ED);
 
-    // Init the GPIO PORTA.4 for a step motor dir/
+    // Init the GPIO PORTA.1, PORTA.4, PORTA.7 for the step motors dir.
     GPIO_InitTypeDef GPIO_InitStruct_DID;
-    GPIO_InitStruct_DID.Pin = GPIO_PIN_4;
-    GPIO_InitStruct_DID.Mode = GPIO_MODE_OUTPUT_PP;
-    HAL_GPIO_Init(GPIOA, &GPIO_InitStruct_DID);
-  }
-
-  if(htim_base->Instance==TIM10)
-  {
-    // Init the TIM11 and the corresponding GPIO.
-    __TIM10_CLK_ENABLE();
-    GPIO_InitStruct.Pin = GPIO_PIN_8;
-    GPIO_InitStruct.Mode = GPIO_MODE_AF_PP;
-    GPIO_InitStruct.Pull = GPIO_NOPULL;
-    GPIO_InitStruct.Speed = GPIO_SPEED_LOW;
-    GPIO_InitStruct.Alternate = GPIO_AF3_TIM10;
-    HAL_GPIO_Init(GPIOB, &GPIO_InitStruct);
-
-    // Init the GPIO PORTA.9 for a step motor enabling/disabling.
-    GPIO_InitTypeDef GPIO_InitStruct_ED;
-    GPIO_InitStruct_ED.Pin = GPIO_PIN_9;
-    GPIO_InitStruct_ED.Mode = GPIO_MODE_OUTPUT_PP;
-    HAL_GPIO_Init(GPIOA, &GPIO_InitStruct_ED);
-
-    // Init the GPIO PORTA.7 for a step motor dir/
-    GPIO_InitTypeDef GPIO_InitStruct_DID;
-    GPIO_InitStruct_DID.Pin = GPIO_PIN_7;
+    GPIO_InitStruct_DID.Pin = GPIO_PIN_1 | GPIO_PIN_4 | GPIO_PIN_7;
     GPIO_InitStruct_DID.Mode = GPIO_MODE_OUTPUT_PP;
+    GPIO_InitStruct_DID.Pull = GPIO_NOPULL;
+    GPIO_InitStruct_DID.Speed = GPIO_SPEED_LOW;
     HAL_GPIO_Init(GPIOA, &GPIO_InitStruct_DID);
   }
 
@@ -196,25 +159,12 @@ void HAL_TIM_Base_MspInit(TIM_HandleTypeDef* htim_base)
 void HAL_TIM_Base_MspDeInit(TIM_HandleTypeDef* htim_base)
 {
 
-  if(htim_base->Instance==TIM10)
-  {
-  /* USER CODE BEGIN TIM10_MspDeInit 0 */
-
-  /* USER CODE END TIM10_MspDeInit 0 */
-    /* Peripheral clock disable */
-    __TIM10_CLK_DISABLE();
-
-    /**TIM10 GPIO Configuration
-    PB8     ------> TIM10_CH1
-    */
-    HAL_GPIO_DeInit(GPIOB, GPIO_PIN_8);
-
-  }
-  if(htim_base->Instance==TIM9)
+  if(htim_base->Instance==TIM8)
   {
-    __TIM9_CLK_DISABLE();
-    HAL_GPIO_DeInit(GPIOA, GPIO_PIN_2);
-    HAL_GPIO_DeInit(GPIOA, GPIO_PIN_3);
+    __TIM8_CLK_DISABLE();
+    HAL_GPIO_DeInit(GPIOA, GPIO_PIN_1 | GPIO_PIN_2 | GPIO_PIN_3 | GPIO_PIN_4 |
+                           GPIO_PIN_6 | GPIO_PIN_7 | GPIO_PIN_9);
+    HAL_GPIO_DeInit(GPIOB, GPIO_PIN_8 | GPIO_PIN_9);
   }
 
 }